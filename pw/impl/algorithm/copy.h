@@ -1,6 +1,10 @@
 #ifndef INCLUDED_PW_IMPL_COPY_H
 #define INCLUDED_PW_IMPL_COPY_H
 
+#include <pw/impl/type_traits/is_constant_evaluated.h>
+#include <pw/internal/bitwise_copy.h>
+#include <pw/internal/is_iterator.h>
+
 namespace pw {
 
 /**
@@ -17,11 +21,22 @@ namespace pw {
  * @return OutputIterator Iterator to the element past the last element copied.
  *
  * @note The source and destination ranges must not overlap.
+ *
+ * Contiguous ranges (see contiguous_iterator) of the same trivially
+ * copyable type are copied with memmove().
  */
 template<class InputIterator, class OutputIterator>
-OutputIterator
+constexpr OutputIterator
 copy(InputIterator begin, InputIterator end, OutputIterator dest)
 {
+    if constexpr (internal::is_bitwise_copyable_range_v<InputIterator, OutputIterator>)
+    {
+        if (!is_constant_evaluated())
+        {
+            internal::bitwise_copy(dest, begin, static_cast<size_t>(end - begin));
+            return dest + (end - begin);
+        }
+    }
     while (begin != end)
     {
         *dest++ = *begin++;
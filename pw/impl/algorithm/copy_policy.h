@@ -0,0 +1,38 @@
+#ifndef INCLUDED_PW_IMPL_COPY_POLICY_H
+#define INCLUDED_PW_IMPL_COPY_POLICY_H
+
+#include <pw/impl/algorithm/copy.h>
+#include <pw/impl/execution/execution_policy.h>
+#include <pw/impl/execution/thread_pool.h>
+#include <pw/internal/is_iterator.h>
+
+namespace pw {
+
+/**
+ * Same as copy() but when both ranges are random access and the
+ * policy is par or par_unseq the range is split across the thread
+ * pool.
+ */
+template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2>
+    requires is_execution_policy_v<remove_cvref_t<ExecutionPolicy>>
+ForwardIterator2
+copy(ExecutionPolicy&& policy, ForwardIterator1 begin, ForwardIterator1 end, ForwardIterator2 dest)
+{
+    if constexpr (internal::is_random_access_iterator_v<ForwardIterator1> &&
+                  internal::is_random_access_iterator_v<ForwardIterator2>)
+    {
+        auto const count = end - begin;
+        auto copy_chunk = [begin, dest](size_t first, size_t last) {
+            pw::copy(begin + first, begin + last, dest + first);
+        };
+        internal::parallel_for(policy, static_cast<size_t>(count), copy_chunk);
+        return dest + count;
+    }
+    else
+    {
+        return pw::copy(begin, end, dest);
+    }
+}
+
+} // namespace pw
+#endif /* INCLUDED_PW_IMPL_COPY_POLICY_H */
@@ -1,12 +1,32 @@
 #ifndef INCLUDED_PW_IMPL_EQUAL_H
 #define INCLUDED_PW_IMPL_EQUAL_H
 
+#include <pw/impl/type_traits/is_constant_evaluated.h>
+#include <pw/internal/bitwise_compare.h>
+#include <pw/internal/is_iterator.h>
+
 namespace pw {
 
+/**
+ * @brief Checks if two ranges have the same elements.
+ *
+ * Contiguous ranges of integers or pointers are compared with memcmp().
+ *
+ * @return true if both ranges are the same length and each pair of
+ *         elements compares equal
+ */
 template<class Iterator1, class Iterator2>
 constexpr bool
 equal(Iterator1 begin1, Iterator1 end1, Iterator2 begin2, Iterator2 end2)
 {
+    if constexpr (internal::is_bitwise_range_v<Iterator1, Iterator2>)
+    {
+        if (!is_constant_evaluated())
+        {
+            return end1 - begin1 == end2 - begin2 &&
+                   internal::bitwise_equal(pw::to_address(begin1), pw::to_address(begin2), end1 - begin1);
+        }
+    }
     while (begin1 != end1 && begin2 != end2)
     {
         if (*begin1 != *begin2)
@@ -0,0 +1,49 @@
+#ifndef INCLUDED_PW_IMPL_EQUAL_POLICY_H
+#define INCLUDED_PW_IMPL_EQUAL_POLICY_H
+
+#include <pw/impl/algorithm/equal.h>
+#include <pw/impl/execution/execution_policy.h>
+#include <pw/impl/execution/thread_pool.h>
+#include <pw/internal/is_iterator.h>
+
+#include <atomic>
+
+namespace pw {
+
+/**
+ * Same as equal() but when both ranges are random access and the
+ * policy is par or par_unseq the comparison is split across the
+ * thread pool.  Chunks that haven't started are skipped once any
+ * difference is found.
+ */
+template<class ExecutionPolicy, class Iterator1, class Iterator2>
+    requires is_execution_policy_v<remove_cvref_t<ExecutionPolicy>>
+bool
+equal(ExecutionPolicy&& policy, Iterator1 begin1, Iterator1 end1, Iterator2 begin2, Iterator2 end2)
+{
+    if constexpr (internal::is_random_access_iterator_v<Iterator1> &&
+                  internal::is_random_access_iterator_v<Iterator2>)
+    {
+        if (end1 - begin1 != end2 - begin2)
+        {
+            return false;
+        }
+        std::atomic<bool> differ { false };
+        auto equal_chunk = [begin1, begin2, &differ](size_t first, size_t last) {
+            if (!differ.load(std::memory_order_relaxed) &&
+                !pw::equal(begin1 + first, begin1 + last, begin2 + first, begin2 + last))
+            {
+                differ.store(true, std::memory_order_relaxed);
+            }
+        };
+        internal::parallel_for(policy, static_cast<size_t>(end1 - begin1), equal_chunk);
+        return !differ.load(std::memory_order_relaxed);
+    }
+    else
+    {
+        return pw::equal(begin1, end1, begin2, end2);
+    }
+}
+
+} // namespace pw
+#endif /* INCLUDED_PW_IMPL_EQUAL_POLICY_H */
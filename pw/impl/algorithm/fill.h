@@ -1,19 +1,34 @@
 #ifndef INCLUDED_PW_IMPL_FILL_H_
 #define INCLUDED_PW_IMPL_FILL_H_
 
+#include <pw/impl/type_traits/is_constant_evaluated.h>
+#include <pw/internal/bitwise_copy.h>
+#include <pw/internal/is_iterator.h>
+
 namespace pw {
 
 /**
  * Copies value into range from begin up to end
  *
+ * Contiguous ranges of trivially copyable types are filled with
+ * memset() or broadcast stores.
+ *
  * @param begin ForwardIterator to start
  * @param end End of range
  * @param value To be copied
  */
 template<class ForwardIterator, class Type>
-void
+constexpr void
 fill(ForwardIterator begin, ForwardIterator end, Type const& value)
 {
+    if constexpr (internal::is_bitwise_fillable_v<ForwardIterator, Type>)
+    {
+        if (!is_constant_evaluated())
+        {
+            internal::bitwise_fill(begin, static_cast<size_t>(end - begin), value);
+            return;
+        }
+    }
     while (begin != end)
     {
         *begin++ = value;
@@ -1,11 +1,34 @@
 #ifndef INCLUDED_PW_IMPL_FILL_N_H
 #define INCLUDED_PW_IMPL_FILL_N_H
 
+#include <pw/impl/type_traits/is_constant_evaluated.h>
+#include <pw/internal/bitwise_copy.h>
+
 namespace pw {
+
+/**
+ * Assigns value to the count elements starting at first.  Contiguous
+ * ranges of trivially copyable types are filled with memset() or
+ * broadcast stores.
+ *
+ * @return Iterator one past the last element assigned
+ */
 template<class Iterator, class Size, class Type>
 constexpr Iterator
 fill_n(Iterator first, Size count, Type const& value)
 {
+    if constexpr (internal::is_bitwise_fillable_v<Iterator, Type>)
+    {
+        if (!is_constant_evaluated())
+        {
+            if (count <= 0)
+            {
+                return first;
+            }
+            internal::bitwise_fill(first, static_cast<size_t>(count), value);
+            return first + count;
+        }
+    }
     for (Size i = 0; i < count; ++i)
     {
         *first++ = value;
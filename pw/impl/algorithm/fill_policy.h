@@ -0,0 +1,34 @@
+#ifndef INCLUDED_PW_IMPL_FILL_POLICY_H
+#define INCLUDED_PW_IMPL_FILL_POLICY_H
+
+#include <pw/impl/algorithm/fill.h>
+#include <pw/impl/execution/execution_policy.h>
+#include <pw/impl/execution/thread_pool.h>
+#include <pw/internal/is_iterator.h>
+
+namespace pw {
+
+/**
+ * Same as fill() but with a random access range and par or par_unseq
+ * the range is split across the thread pool.
+ */
+template<class ExecutionPolicy, class ForwardIterator, class Type>
+    requires is_execution_policy_v<remove_cvref_t<ExecutionPolicy>>
+void
+fill(ExecutionPolicy&& policy, ForwardIterator begin, ForwardIterator end, Type const& value)
+{
+    if constexpr (internal::is_random_access_iterator_v<ForwardIterator>)
+    {
+        auto fill_chunk = [begin, &value](size_t first, size_t last) {
+            pw::fill(begin + first, begin + last, value);
+        };
+        internal::parallel_for(policy, static_cast<size_t>(end - begin), fill_chunk);
+    }
+    else
+    {
+        pw::fill(begin, end, value);
+    }
+}
+
+} // namespace pw
+#endif /* INCLUDED_PW_IMPL_FILL_POLICY_H */
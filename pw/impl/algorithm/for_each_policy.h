@@ -0,0 +1,38 @@
+#ifndef INCLUDED_PW_IMPL_FOR_EACH_POLICY_H
+#define INCLUDED_PW_IMPL_FOR_EACH_POLICY_H
+
+#include <pw/impl/algorithm/for_each.h>
+#include <pw/impl/execution/execution_policy.h>
+#include <pw/impl/execution/thread_pool.h>
+#include <pw/internal/is_iterator.h>
+
+namespace pw {
+
+/**
+ * Calls function on every element.  With a random access range and
+ * par or par_unseq the range is split across the thread pool so
+ * function is called concurrently (on different elements).
+ */
+template<class ExecutionPolicy, class ForwardIterator, class UnaryFunction>
+    requires is_execution_policy_v<remove_cvref_t<ExecutionPolicy>>
+void
+for_each(ExecutionPolicy&& policy, ForwardIterator begin, ForwardIterator end, UnaryFunction function)
+{
+    if constexpr (internal::is_random_access_iterator_v<ForwardIterator>)
+    {
+        auto for_each_chunk = [begin, &function](size_t first, size_t last) {
+            for (ForwardIterator iter = begin + first, stop = begin + last; iter != stop; ++iter)
+            {
+                function(*iter);
+            }
+        };
+        internal::parallel_for(policy, static_cast<size_t>(end - begin), for_each_chunk);
+    }
+    else
+    {
+        pw::for_each(begin, end, function);
+    }
+}
+
+} // namespace pw
+#endif /* INCLUDED_PW_IMPL_FOR_EACH_POLICY_H */
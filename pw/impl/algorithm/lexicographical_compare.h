@@ -1,12 +1,29 @@
 #ifndef INCLUDED_PW_IMPL_LEXICOGRAPHICAL_COMPARE_H
 #define INCLUDED_PW_IMPL_LEXICOGRAPHICAL_COMPARE_H
 
+#include <pw/impl/type_traits/is_constant_evaluated.h>
+#include <pw/internal/bitwise_compare.h>
+
 namespace pw {
 
+/**
+ * @brief Checks if the first range is lexicographically less than the
+ * second.
+ *
+ * Contiguous ranges of integers or pointers are compared with memcmp().
+ */
 template<class Iterator1, class Iterator2>
-bool
+constexpr bool
 lexicographical_compare(Iterator1 begin1, Iterator1 end1, Iterator2 begin2, Iterator2 end2)
 {
+    if constexpr (internal::is_bitwise_range_v<Iterator1, Iterator2>)
+    {
+        if (!is_constant_evaluated())
+        {
+            return internal::bitwise_compare(
+                       pw::to_address(begin1), end1 - begin1, pw::to_address(begin2), end2 - begin2) < 0;
+        }
+    }
     while (begin1 != end1 && begin2 != end2)
     {
         if (*begin1 < *begin2)
@@ -1,7 +1,9 @@
 #ifndef INCLUDED_PW_IMPL_MOVE_ALG_H
 #define INCLUDED_PW_IMPL_MOVE_ALG_H
 
+#include <pw/impl/type_traits/is_constant_evaluated.h>
 #include <pw/impl/utility/move.h>
+#include <pw/internal/bitwise_copy.h>
 
 namespace pw {
 
@@ -18,14 +20,25 @@ namespace pw {
  *
  * @note The ranges [begin, end) and [dest, dest + (end - begin)) must not overlap,
  *       or if they overlap, dest must not be in the range (begin, end].
+ *
+ * Contiguous ranges (see contiguous_iterator) of the same trivially
+ * copyable type are copied with memmove().
  */
 template<class InputIterator, class OutputIterator>
-OutputIterator
+constexpr OutputIterator
 move(InputIterator begin, InputIterator end, OutputIterator dest)
 {
+    if constexpr (internal::is_bitwise_copyable_range_v<InputIterator, OutputIterator>)
+    {
+        if (!is_constant_evaluated())
+        {
+            internal::bitwise_copy(dest, begin, static_cast<size_t>(end - begin));
+            return dest + (end - begin);
+        }
+    }
     while (begin != end)
     {
-        *dest++ = move(*begin++);
+        *dest++ = pw::move(*begin++);
     }
     return dest;
 }
@@ -1,7 +1,9 @@
 #ifndef INCLUDED_PW_IMPL_MOVE_BACKWARD_H
 #define INCLUDED_PW_IMPL_MOVE_BACKWARD_H
 
+#include <pw/impl/type_traits/is_constant_evaluated.h>
 #include <pw/impl/utility/move.h>
+#include <pw/internal/bitwise_copy.h>
 
 namespace pw {
 
@@ -19,14 +21,26 @@ namespace pw {
  *
  * @note The ranges [begin, end) and [dest - (end - begin), dest) must not overlap,
  *       or if they overlap, dest must not be in the range [begin, end).
+ *
+ * Contiguous ranges (see contiguous_iterator) of the same trivially
+ * copyable type are copied with memmove().
  */
 template<class Iterator1, class Iterator2>
-Iterator2
+constexpr Iterator2
 move_backward(Iterator1 begin, Iterator1 end, Iterator2 dest)
 {
+    if constexpr (internal::is_bitwise_copyable_range_v<Iterator1, Iterator2>)
+    {
+        if (!is_constant_evaluated())
+        {
+            dest -= end - begin;
+            internal::bitwise_copy(dest, begin, static_cast<size_t>(end - begin));
+            return dest;
+        }
+    }
     while (begin != end)
     {
-        *--dest = move(*--end);
+        *--dest = pw::move(*--end);
     }
     return dest;
 }
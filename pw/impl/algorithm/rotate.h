@@ -0,0 +1,67 @@
+#ifndef INCLUDED_PW_IMPL_ROTATE_H
+#define INCLUDED_PW_IMPL_ROTATE_H
+
+#include <pw/impl/utility/swap.h>
+
+namespace pw {
+
+/**
+ * @brief Rotates [begin, end) so middle becomes the first element.
+ *
+ * Swaps blocks from the front (the forward iterator algorithm) so
+ * each element is swapped at most once into its final place.
+ *
+ * @param begin Start of the range
+ * @param middle The element that ends up at begin
+ * @param end One past the end of the range
+ * @return Where the element that was at begin ends up
+ */
+template<class ForwardIterator>
+constexpr ForwardIterator
+rotate(ForwardIterator begin, ForwardIterator middle, ForwardIterator end)
+{
+    if (begin == middle)
+    {
+        return end;
+    }
+    if (middle == end)
+    {
+        return begin;
+    }
+    using pw::swap;
+
+    // The first pass finds where begin ends up
+    ForwardIterator next = middle;
+    while (true)
+    {
+        swap(*begin++, *next);
+        if (++next == end)
+        {
+            break;
+        }
+        if (begin == middle)
+        {
+            middle = next;
+        }
+    }
+    ForwardIterator const result = begin;
+
+    // Then rotate whatever is left of [begin, end)
+    next = middle;
+    while (begin != middle)
+    {
+        swap(*begin++, *next);
+        if (++next == end)
+        {
+            next = middle;
+        }
+        else if (begin == middle)
+        {
+            middle = next;
+        }
+    }
+    return result;
+}
+
+} // namespace pw
+#endif /* INCLUDED_PW_IMPL_ROTATE_H */
@@ -1,10 +1,17 @@
 #ifndef INCLUDED_PW_IMPL_ALLOCATOR_H
 #define INCLUDED_PW_IMPL_ALLOCATOR_H
 
+#include <pw/impl/cstddef/max_align.h>
 #include <pw/impl/cstddef/ptrdiff.h>
 #include <pw/impl/cstddef/size.h>
+#include <pw/impl/memory/allocation_result.h>
 #include <pw/impl/type_traits/bool_type.h>
 #include <pw/impl/type_traits/is_constant_evaluated.h>
+#include <pw/impl/type_traits/is_trivially_relocatable.h>
+#include <pw/internal/size_class.h>
+
+#include <cstdlib>
+#include <new>
 
 namespace pw {
 
@@ -17,8 +24,17 @@ struct allocator
     using is_always_equal                        = true_type;
     using propagate_on_container_move_assignment = true_type;
 
-    [[nodiscard]] constexpr Type* allocate(size_type count);
-    constexpr void                deallocate(Type* ptr, size_type count);
+    [[nodiscard]] constexpr Type*                               allocate(size_type count);
+    [[nodiscard]] constexpr allocation_result<Type*, size_type> allocate_at_least(size_type count);
+    [[nodiscard]] allocation_result<Type*, size_type>           allocate_zeroed(size_type count);
+    constexpr void                                              deallocate(Type* ptr, size_type count);
+
+    [[nodiscard]] constexpr Type* try_expand(Type* ptr, size_type count, size_type new_count);
+
+private:
+    // Trivially relocatable types come from malloc() so they can be realloc()'d
+    static constexpr bool uses_realloc =
+        is_trivially_relocatable_v<Type> && alignof(Type) <= alignof(max_align_t);
 };
 
 // Non-member operator declarations
@@ -44,9 +60,72 @@ allocator<Type>::allocate(size_type count)
         if (is_constant_evaluated())
             return new Type[count];
     }
+    if constexpr (uses_realloc)
+    {
+        void* p = std::malloc(count * sizeof(Type));
+        if (p == nullptr && count > 0)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<Type*>(p);
+    }
     return static_cast<Type*>(operator new(count * sizeof(Type)));
 }
 
+/**
+ * Allocates room for at least count elements, rounded up to the
+ * block size malloc() is likely to hand out (see
+ * internal::allocation_size()).
+ *
+ * @param count The minimum number of elements
+ * @return The memory and how many elements it holds
+ * @exception std::bad_alloc if memory allocation fails
+ */
+template<class Type>
+constexpr allocation_result<Type*, typename allocator<Type>::size_type>
+allocator<Type>::allocate_at_least(size_type count)
+{
+    if (!is_constant_evaluated())
+    {
+        count = internal::allocation_size(count * sizeof(Type)) / sizeof(Type);
+    }
+    return { allocate(count), count };
+}
+
+/**
+ * Allocates room for at least count elements, like allocate_at_least(),
+ * with every byte zero.
+ *
+ * The memory comes from calloc().  Large blocks are fresh anonymous
+ * mmap() pages that the kernel already guarantees are zero, so nothing
+ * is written here and each page only becomes real memory when it is
+ * first touched.  Types that don't come from malloc() (see
+ * uses_realloc) are allocated as usual and then cleared with memset().
+ *
+ * @param count The minimum number of elements
+ * @return The zeroed memory and how many elements it holds
+ * @exception std::bad_alloc if memory allocation fails
+ */
+template<class Type>
+allocation_result<Type*, typename allocator<Type>::size_type>
+// ReSharper disable once CppMemberFunctionMayBeStatic
+allocator<Type>::allocate_zeroed(size_type count)
+{
+    count = internal::allocation_size(count * sizeof(Type)) / sizeof(Type);
+    if constexpr (uses_realloc)
+    {
+        void* p = std::calloc(count, sizeof(Type));
+        if (p == nullptr && count > 0)
+        {
+            throw std::bad_alloc();
+        }
+        return { static_cast<Type*>(p), count };
+    }
+    Type* p = static_cast<Type*>(operator new(count * sizeof(Type)));
+    __builtin_memset(static_cast<void*>(p), 0, count * sizeof(Type));
+    return { p, count };
+}
+
 template<class Type>
 constexpr void
 // ReSharper disable once CppMemberFunctionMayBeStatic
@@ -61,9 +140,42 @@ allocator<Type>::deallocate(Type* ptr, size_type)
             return;
         }
     }
+    if constexpr (uses_realloc)
+    {
+        std::free(ptr);
+        return;
+    }
     operator delete(static_cast<void*>(ptr));
 }
 
+/**
+ * Grows the allocation at ptr from count to new_count elements.
+ *
+ * Only trivially relocatable types are supported as realloc() may move
+ * the bytes to a new address.  Large blocks are remapped by the C
+ * library (mremap() on Linux) rather than copied.
+ *
+ * @param ptr Memory returned by allocate(count)
+ * @param count The number of elements ptr was allocated with
+ * @param new_count The number of elements wanted
+ * @return The grown memory, which replaces ptr, or nullptr if it could
+ *         not be grown; ptr is then unchanged.
+ */
+template<class Type>
+constexpr Type*
+// ReSharper disable once CppMemberFunctionMayBeStatic
+allocator<Type>::try_expand(Type* ptr, size_type, size_type new_count)
+{
+    if constexpr (uses_realloc)
+    {
+        if (!is_constant_evaluated())
+        {
+            return static_cast<Type*>(std::realloc(ptr, new_count * sizeof(Type)));
+        }
+    }
+    return nullptr;
+}
+
 template<class Type1, class Type2>
 bool
 operator==(allocator<Type1> const&, allocator<Type2> const&)
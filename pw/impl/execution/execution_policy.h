@@ -0,0 +1,88 @@
+#ifndef INCLUDED_PW_IMPL_EXECUTION_POLICY_H
+#define INCLUDED_PW_IMPL_EXECUTION_POLICY_H
+
+#include <pw/impl/type_traits/bool_type.h>
+#include <pw/impl/type_traits/is_same.h>
+#include <pw/impl/type_traits/remove_cvref.h>
+
+namespace pw {
+namespace execution {
+
+/**
+ * Run the algorithm on the calling thread.
+ */
+struct sequenced_policy
+{
+};
+
+/**
+ * Split the range across the built-in thread pool.  The element
+ * functions may run concurrently on different elements.
+ */
+struct parallel_policy
+{
+};
+
+/**
+ * Same as parallel_policy; each chunk may also be vectorized.
+ */
+struct parallel_unsequenced_policy
+{
+};
+
+/**
+ * Run on the calling thread but allow the loop to be vectorized.
+ */
+struct unsequenced_policy
+{
+};
+
+inline constexpr sequenced_policy            seq {};
+inline constexpr parallel_policy             par {};
+inline constexpr parallel_unsequenced_policy par_unseq {};
+inline constexpr unsequenced_policy          unseq {};
+
+} // namespace execution
+
+template<class Type>
+struct is_execution_policy : false_type
+{
+};
+
+template<>
+struct is_execution_policy<execution::sequenced_policy> : true_type
+{
+};
+
+template<>
+struct is_execution_policy<execution::parallel_policy> : true_type
+{
+};
+
+template<>
+struct is_execution_policy<execution::parallel_unsequenced_policy> : true_type
+{
+};
+
+template<>
+struct is_execution_policy<execution::unsequenced_policy> : true_type
+{
+};
+
+template<class Type>
+inline constexpr bool is_execution_policy_v = is_execution_policy<Type>::value;
+
+namespace internal {
+
+/**
+ * True for the policies (ignoring cv and references) that are allowed
+ * to use more than one thread.
+ */
+template<class Policy>
+inline constexpr bool is_parallel_policy_v =
+    is_same_v<remove_cvref_t<Policy>, execution::parallel_policy> ||
+    is_same_v<remove_cvref_t<Policy>, execution::parallel_unsequenced_policy>;
+
+} // namespace internal
+} // namespace pw
+#endif /* INCLUDED_PW_IMPL_EXECUTION_POLICY_H */
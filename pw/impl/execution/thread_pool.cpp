@@ -0,0 +1,276 @@
+#include <pw/impl/execution/thread_pool.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace pw::internal {
+
+namespace {
+
+// Chunk ranges are packed as [low, high) into one word so they can be
+// claimed and stolen with a single compare and swap
+constexpr std::uint64_t s_low_mask   = 0xffffffffu;
+constexpr size_t        s_max_chunks = s_low_mask;
+
+// Aim for this many chunks per thread so stealing has something to take
+constexpr size_t s_chunks_per_thread = 8;
+
+// Set on the pool's own threads so a nested parallel call runs inline
+thread_local bool t_in_pool = false;
+
+constexpr std::uint64_t
+pack(std::uint64_t low, std::uint64_t high) noexcept
+{
+    return low | (high << 32);
+}
+
+/**
+ * One call to parallel_run().  Each thread owns a range of chunks; it
+ * takes chunks from the front of its own and thieves take the back
+ * half of someone else's.
+ */
+struct Job
+{
+    struct alignas(64) Range
+    {
+        std::atomic<std::uint64_t> chunks;
+    };
+
+    ParallelTask             task;
+    void*                    context;
+    size_t                   count;
+    size_t                   chunk_size;
+    size_t                   threads;
+    std::unique_ptr<Range[]> ranges;
+    std::atomic<size_t>      pending;
+
+    void run_chunk(std::uint64_t chunk) const noexcept
+    {
+        size_t const begin = chunk * chunk_size;
+        size_t const end   = count - begin < chunk_size ? count : begin + chunk_size;
+        task(context, begin, end);
+    }
+
+    bool pop(size_t self) noexcept
+    {
+        std::atomic<std::uint64_t>& chunks = ranges[self].chunks;
+        std::uint64_t               range  = chunks.load(std::memory_order_acquire);
+        while ((range & s_low_mask) < (range >> 32))
+        {
+            if (chunks.compare_exchange_weak(range, range + 1, std::memory_order_acq_rel))
+            {
+                run_chunk(range & s_low_mask);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool steal(size_t self) noexcept
+    {
+        for (size_t offset = 1; offset < threads; ++offset)
+        {
+            std::atomic<std::uint64_t>& chunks = ranges[(self + offset) % threads].chunks;
+            std::uint64_t               range  = chunks.load(std::memory_order_acquire);
+            while ((range & s_low_mask) < (range >> 32))
+            {
+                std::uint64_t const low  = range & s_low_mask;
+                std::uint64_t const high = range >> 32;
+                std::uint64_t const mid  = high - (high - low + 1) / 2;
+                if (chunks.compare_exchange_weak(range, pack(low, mid), std::memory_order_acq_rel))
+                {
+                    // Only this thread adds to its own range so a plain
+                    // store is enough; thieves only CAS a non-empty one
+                    ranges[self].chunks.store(pack(mid, high), std::memory_order_release);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void work(size_t self) noexcept
+    {
+        do
+        {
+            while (pop(self))
+            {
+            }
+        } while (steal(self));
+    }
+};
+
+class ThreadPool
+{
+public:
+    explicit ThreadPool(size_t workers);
+    ThreadPool(ThreadPool const&) = delete;
+    ~ThreadPool();
+
+    ThreadPool& operator=(ThreadPool const&) = delete;
+
+    size_t concurrency() const noexcept { return m_workers + 1; }
+    bool   run(size_t count, size_t grain, ParallelTask task, void* context);
+
+private:
+    void worker(size_t self);
+
+    size_t                         m_workers;
+    std::unique_ptr<std::thread[]> m_threads;
+    std::mutex                     m_busy;
+    std::mutex                     m_mutex;
+    std::condition_variable        m_wake;
+    std::condition_variable        m_done;
+    Job*                           m_job        = nullptr;
+    std::uint64_t                  m_generation = 0;
+    bool                           m_stop       = false;
+};
+
+ThreadPool::ThreadPool(size_t workers)
+    : m_workers(workers)
+    , m_threads(std::make_unique<std::thread[]>(workers))
+{
+    for (size_t index = 0; index < m_workers; ++index)
+    {
+        m_threads[index] = std::thread([this, index] { worker(index + 1); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (size_t index = 0; index < m_workers; ++index)
+    {
+        m_threads[index].join();
+    }
+}
+
+/**
+ * Deals the chunks out, wakes the workers, does the calling thread's
+ * share and waits for every worker to finish with the job.
+ *
+ * @return false without doing anything if the pool is in use
+ */
+bool
+ThreadPool::run(size_t count, size_t grain, ParallelTask task, void* context)
+{
+    std::unique_lock busy(m_busy, std::try_to_lock);
+    if (!busy.owns_lock())
+    {
+        return false;
+    }
+
+    size_t const threads    = concurrency();
+    size_t       chunk_size = count / (threads * s_chunks_per_thread);
+    if (chunk_size < grain)
+    {
+        chunk_size = grain;
+    }
+    if (count / chunk_size >= s_max_chunks)
+    {
+        chunk_size = count / (s_max_chunks - 1);
+    }
+    size_t const chunks = (count + chunk_size - 1) / chunk_size;
+
+    Job job { task, context, count, chunk_size, threads, std::make_unique<Job::Range[]>(threads), m_workers };
+    for (size_t index = 0; index < threads; ++index)
+    {
+        job.ranges[index].chunks.store(pack(chunks * index / threads, chunks * (index + 1) / threads),
+                                       std::memory_order_relaxed);
+    }
+    {
+        std::lock_guard lock(m_mutex);
+        m_job = &job;
+        ++m_generation;
+    }
+    m_wake.notify_all();
+
+    job.work(0);
+
+    std::unique_lock lock(m_mutex);
+    m_done.wait(lock, [&job] { return job.pending.load(std::memory_order_acquire) == 0; });
+    m_job = nullptr;
+    return true;
+}
+
+void
+ThreadPool::worker(size_t self)
+{
+    t_in_pool = true;
+
+    std::uint64_t    seen = 0;
+    std::unique_lock lock(m_mutex);
+    while (true)
+    {
+        m_wake.wait(lock, [this, seen] { return m_stop || m_generation != seen; });
+        if (m_stop)
+        {
+            return;
+        }
+        seen     = m_generation;
+        Job* job = m_job;
+        lock.unlock();
+
+        job->work(self);
+
+        lock.lock();
+        if (job->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            m_done.notify_one();
+        }
+    }
+}
+
+/**
+ * @return How many threads to use: PW_THREADS from the environment if
+ *         it is set and otherwise one per hardware thread
+ */
+size_t
+default_concurrency()
+{
+    if (char const* threads = std::getenv("PW_THREADS"))
+    {
+        unsigned long const count = std::strtoul(threads, nullptr, 10);
+        if (count > 0)
+        {
+            return count;
+        }
+    }
+    unsigned const hardware = std::thread::hardware_concurrency();
+    return hardware > 0 ? hardware : 1;
+}
+
+ThreadPool&
+pool()
+{
+    static ThreadPool s_pool(default_concurrency() - 1);
+    return s_pool;
+}
+
+} // namespace
+
+size_t
+parallel_concurrency() noexcept
+{
+    return t_in_pool ? 1 : pool().concurrency();
+}
+
+void
+parallel_run(size_t count, size_t grain, ParallelTask task, void* context)
+{
+    if (t_in_pool || count <= grain || pool().concurrency() == 1 || !pool().run(count, grain, task, context))
+    {
+        task(context, 0, count);
+    }
+}
+
+} // namespace pw::internal
@@ -0,0 +1,68 @@
+#ifndef INCLUDED_PW_IMPL_EXECUTION_THREAD_POOL_H
+#define INCLUDED_PW_IMPL_EXECUTION_THREAD_POOL_H
+
+#include <pw/impl/cstddef/size.h>
+#include <pw/impl/execution/execution_policy.h>
+#include <pw/impl/type_traits/remove_reference.h>
+
+namespace pw::internal {
+
+/**
+ * A chunk of work: call it for the elements [begin, end).
+ */
+using ParallelTask = void (*)(void* context, size_t begin, size_t end) noexcept;
+
+/**
+ * Ranges shorter than this aren't worth waking other threads for
+ * and no thread is handed a chunk smaller than it.
+ */
+inline constexpr size_t parallel_grain = 16 * 1024;
+
+/**
+ * @return The number of threads a parallel algorithm uses: the pool's
+ *         workers plus the calling thread
+ */
+size_t parallel_concurrency() noexcept;
+
+/**
+ * Calls task on chunks covering [0, count) using the built-in thread
+ * pool.  The calling thread works too and returns once every chunk is
+ * done.
+ *
+ * The chunks are dealt out evenly up front.  A thread that finishes
+ * its share steals half of what's left of another thread's so an
+ * uneven workload still keeps every thread busy.
+ *
+ * Runs task(context, 0, count) on the calling thread if the pool is
+ * already busy (including a nested call from one of its workers).
+ */
+void parallel_run(size_t count, size_t grain, ParallelTask task, void* context);
+
+/**
+ * Calls function(begin, end) on chunks covering [0, count): spread
+ * across the thread pool for par and par_unseq when count is large
+ * enough and as one call on this thread otherwise.
+ *
+ * As with the standard parallel algorithms an exception escaping
+ * function in a parallel run calls std::terminate().
+ */
+template<class Policy, class Function>
+void
+parallel_for(Policy&&, size_t count, Function&& function)
+{
+    if constexpr (is_parallel_policy_v<Policy>)
+    {
+        if (count >= 2 * parallel_grain)
+        {
+            ParallelTask task = [](void* context, size_t begin, size_t end) noexcept {
+                (*static_cast<typename remove_reference<Function>::type*>(context))(begin, end);
+            };
+            parallel_run(count, parallel_grain, task, &function);
+            return;
+        }
+    }
+    function(size_t(0), count);
+}
+
+} // namespace pw::internal
+#endif /* INCLUDED_PW_IMPL_EXECUTION_THREAD_POOL_H */
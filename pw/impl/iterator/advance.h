@@ -3,7 +3,7 @@
 
 #include <pw/impl/iterator/iterator_tag.h>
 #include <pw/impl/iterator/iterator_traits.h>
-#include <pw/impl/type_traits/is_same.h>
+#include <pw/impl/type_traits/is_base_of.h>
 
 namespace pw {
 
@@ -21,11 +21,11 @@ advance(Iterator& iterator, Distance n)
 {
     using iterator_category = iterator_traits<Iterator>::iterator_category;
 
-    if constexpr (is_same<iterator_category, random_access_iterator_tag>::value)
+    if constexpr (is_base_of<random_access_iterator_tag, iterator_category>::value)
     {
         iterator += n;
     }
-    else if constexpr (is_same<iterator_category, bidirectional_iterator_tag>::value)
+    else if constexpr (is_base_of<bidirectional_iterator_tag, iterator_category>::value)
     {
         while (n > 0)
         {
@@ -0,0 +1,31 @@
+#ifndef INCLUDED_PW_IMPL_CONTIGUOUS_ITERATOR_H
+#define INCLUDED_PW_IMPL_CONTIGUOUS_ITERATOR_H
+
+#include <pw/internal/is_iterator.h>
+
+namespace pw {
+
+/**
+ * An iterator whose elements are adjacent in memory so to_address()
+ * turns a range of them into a range of pointers.
+ *
+ * This is simpler than std::contiguous_iterator: Iterator only has to
+ * say so with its iterator_concept or iterator_category (pointers
+ * always are).
+ */
+template<class Iterator>
+concept contiguous_iterator = internal::is_contiguous_iterator_v<Iterator>;
+
+/**
+ * A range, such as pw::vector or std::string, whose begin() is a
+ * contiguous_iterator.
+ */
+template<class Range>
+concept contiguous_range = requires(Range& range) {
+    { range.begin() } -> contiguous_iterator;
+    range.end();
+};
+
+} // namespace pw
+
+#endif /* INCLUDED_PW_IMPL_CONTIGUOUS_ITERATOR_H */
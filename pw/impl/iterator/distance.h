@@ -2,14 +2,15 @@
 #define INCLUDED_PW_IMPL_DISTANCE_H
 
 #include <pw/impl/iterator/iterator_traits.h>
-#include <pw/impl/type_traits/is_same.h>
+#include <pw/impl/type_traits/is_base_of.h>
 
 namespace pw {
 
 /**
  * @brief Calculates the number of elements between two iterators
  *
- * For random access iterators, this function performs end - begin in constant time.
+ * For random access (and contiguous) iterators, this function performs end - begin in
+ * constant time.
  * For other iterator categories, it advances from begin to end and counts the steps,
  * resulting in linear time complexity.
  *
@@ -29,7 +30,7 @@ distance(Iterator begin, Iterator end)
 {
     using iterator_category = iterator_traits<Iterator>::iterator_category;
 
-    if constexpr (is_same<iterator_category, random_access_iterator_tag>::value)
+    if constexpr (is_base_of<random_access_iterator_tag, iterator_category>::value)
     {
         return end - begin;
     }
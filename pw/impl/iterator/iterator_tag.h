@@ -15,6 +15,7 @@ using output_iterator_tag        = std::output_iterator_tag;
 using forward_iterator_tag       = std::forward_iterator_tag;
 using bidirectional_iterator_tag = std::bidirectional_iterator_tag;
 using random_access_iterator_tag = std::random_access_iterator_tag;
+using contiguous_iterator_tag    = std::contiguous_iterator_tag;
 
 #ifdef notdef
 struct input_iterator_tag
@@ -36,6 +37,10 @@ struct bidirectional_iterator_tag : public forward_iterator_tag
 struct random_access_iterator_tag : public bidirectional_iterator_tag
 {
 };
+
+struct contiguous_iterator_tag : public random_access_iterator_tag
+{
+};
 #endif
 
 } // namespace pw
@@ -16,9 +16,14 @@ struct iterator_traits
     using reference         = Iterator::reference;
 };
 
+/**
+ * Pointers are random access and, as with std::iterator_traits, the
+ * stronger contiguous_iterator_tag is their iterator_concept.
+ */
 template<class Type>
 struct iterator_traits<Type*>
 {
+    using iterator_concept  = contiguous_iterator_tag;
     using iterator_category = random_access_iterator_tag;
     using value_type        = Type;
     using difference_type   = ptrdiff_t;
@@ -5,6 +5,8 @@
 #include <pw/impl/iterator/iterator_traits.h>
 #include <pw/impl/iterator/next.h>
 #include <pw/impl/iterator/prev.h>
+#include <pw/impl/type_traits/conditional.h>
+#include <pw/impl/type_traits/is_base_of.h>
 
 namespace pw {
 
@@ -12,8 +14,12 @@ template<class Iterator>
 class reverse_iterator
 {
 public:
+    // Reversed elements aren't contiguous so the category stops at random access
     using iterator_type     = Iterator;
-    using iterator_category = iterator_traits<Iterator>::iterator_category;
+    using iterator_category = conditional<
+        is_base_of<contiguous_iterator_tag, typename iterator_traits<Iterator>::iterator_category>::value,
+        random_access_iterator_tag,
+        typename iterator_traits<Iterator>::iterator_category>::type;
     using value_type        = iterator_traits<Iterator>::value_type;
     using difference_type   = iterator_traits<Iterator>::difference_type;
     using pointer           = iterator_traits<Iterator>::pointer;
@@ -29,17 +29,65 @@ inline bool constexpr has_construct_impl<decltype((void)pw::declval<Alloc>().con
 template<class Alloc, class... Args>
 inline bool constexpr has_construct_v = has_construct_impl<void, Alloc, Args...>;
 
+template<class, class Alloc, class Type>
+inline bool constexpr has_destroy_impl = false;
+
+template<class Alloc, class Type>
+inline bool constexpr has_destroy_impl<decltype((void)pw::declval<Alloc>().destroy(pw::declval<Type*>())),
+                                       Alloc,
+                                       Type> = true;
+template<class Alloc, class Type>
+inline bool constexpr has_destroy_v = has_destroy_impl<void, Alloc, Type>;
+
+template<class Alloc>
+struct allocator_traits;
+
 template<class, class Alloc>
 inline bool constexpr has_allocate_at_least_impl = false;
 
 template<class Alloc>
-inline bool constexpr has_allocate_at_least_impl<decltype((void)pw::declval<Alloc>().allocate_at_least(
-                                                     pw::declval<typename Alloc::size_type>())),
-                                                 Alloc> = true;
+inline bool constexpr has_allocate_at_least_impl<
+    decltype((void)pw::declval<Alloc>().allocate_at_least(
+        pw::declval<typename allocator_traits<Alloc>::size_type>())),
+    Alloc> = true;
 
 template<class Alloc>
 inline bool constexpr has_allocate_at_least_v = has_allocate_at_least_impl<void, Alloc>;
 
+template<class, class Alloc>
+inline bool constexpr has_try_expand_impl = false;
+
+template<class Alloc>
+inline bool constexpr has_try_expand_impl<decltype((void)pw::declval<Alloc>().try_expand(
+                                              pw::declval<typename Alloc::value_type*>(),
+                                              pw::declval<typename allocator_traits<Alloc>::size_type>(),
+                                              pw::declval<typename allocator_traits<Alloc>::size_type>())),
+                                          Alloc> = true;
+
+/**
+ * Alloc supports the (non-standard) expandable allocator protocol:
+ * `try_expand(p, count, new_count)` grows an allocation, possibly moving
+ * its bytes, and returns nullptr if it cannot.
+ */
+template<class Alloc>
+inline bool constexpr has_try_expand_v = has_try_expand_impl<void, Alloc>;
+
+template<class, class Alloc>
+inline bool constexpr has_allocate_zeroed_impl = false;
+
+template<class Alloc>
+inline bool constexpr has_allocate_zeroed_impl<
+    decltype((void)pw::declval<Alloc>().allocate_zeroed(pw::declval<size_t>())),
+    Alloc> = true;
+
+/**
+ * Alloc supports the (non-standard) zeroed allocation protocol:
+ * `allocate_zeroed(n)` works like `allocate_at_least(n)` but every byte
+ * of the memory is zero, typically fresh pages the OS zeroes lazily.
+ */
+template<class Alloc>
+inline bool constexpr has_allocate_zeroed_v = has_allocate_zeroed_impl<void, Alloc>;
+
 /**
  * @brief Provides a uniform interface to allocator types.
  *
@@ -84,7 +132,10 @@ struct allocator_traits
     static constexpr pointer allocate(allocator_type& alloc, size_type n);
     static constexpr allocation_result<pointer, size_type>
                                allocate_at_least(allocator_type& alloc, size_type n);
+    static constexpr allocation_result<pointer, size_type>
+                               allocate_zeroed(allocator_type& alloc, size_type n);
     static constexpr void      deallocate(allocator_type& alloc, pointer p, size_type count);
+    static constexpr pointer   try_expand(allocator_type& alloc, pointer p, size_type count, size_type new_count);
     static constexpr Alloc     select_on_container_copy_construction(Alloc const& alloc);
     static constexpr size_type max_size(Alloc const& alloc);
 
@@ -113,9 +164,10 @@ private:
 
     template<typename A, typename T>
     static constexpr auto destroy_impl(A& a, // NOLINT(runtime/references)
-                                       T* p) -> decltype(a.destroy(p));
+                                       T* p,
+                                       int) -> decltype(a.destroy(p));
     template<typename T>
-    static constexpr void destroy_impl(Alloc&, T* p);
+    static constexpr void destroy_impl(Alloc&, T* p, ...);
 };
 
 // Implementation section
@@ -141,6 +193,29 @@ allocator_traits<Alloc>::allocate_at_least(allocator_type& alloc, size_type n)
     }
 }
 
+/**
+ * Allocates at least n elements whose bytes are all zero using
+ * `alloc.allocate_zeroed()` if Alloc has one.
+ *
+ * @return The memory and how many elements it holds or { nullptr, 0 }
+ *         if Alloc does not support it
+ */
+template<class Alloc>
+constexpr allocation_result<typename allocator_traits<Alloc>::pointer,
+                            typename allocator_traits<Alloc>::size_type>
+allocator_traits<Alloc>::allocate_zeroed(allocator_type& alloc, size_type n)
+{
+    if constexpr (has_allocate_zeroed_v<allocator_type>)
+    {
+        auto const result = alloc.allocate_zeroed(n);
+        return { result.ptr, static_cast<size_type>(result.count) };
+    }
+    else
+    {
+        return { nullptr, 0 };
+    }
+}
+
 template<class Alloc>
 constexpr void
 allocator_traits<Alloc>::deallocate(allocator_type& alloc, pointer p, size_type count)
@@ -148,6 +223,27 @@ allocator_traits<Alloc>::deallocate(allocator_type& alloc, pointer p, size_type
     alloc.deallocate(p, count);
 }
 
+/**
+ * Grows the allocation p of count elements to new_count elements using
+ * `alloc.try_expand()` if Alloc has one.
+ *
+ * @return The grown allocation or nullptr if Alloc does not support it
+ *         or could not do it; p is then still valid.
+ */
+template<class Alloc>
+constexpr allocator_traits<Alloc>::pointer
+allocator_traits<Alloc>::try_expand(allocator_type& alloc, pointer p, size_type count, size_type new_count)
+{
+    if constexpr (has_try_expand_v<allocator_type>)
+    {
+        return alloc.try_expand(p, count, new_count);
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
 // ReSharper disable once CppDoxygenUnresolvedReference
 /**
  * @brief Constructs an object in allocated uninitialized storage.
@@ -201,7 +297,7 @@ template<class Type>
 constexpr void
 allocator_traits<Alloc>::destroy(allocator_type& a, Type* p)
 {
-    destroy_impl(a, p);
+    destroy_impl(a, p, 0);
 }
 
 template<class Alloc>
@@ -254,7 +350,8 @@ template<class Alloc>
 template<typename A, typename T>
 constexpr auto
 allocator_traits<Alloc>::destroy_impl(A& a, // NOLINT(runtime/references)
-                                      T* p) -> decltype(a.destroy(p))
+                                      T* p,
+                                      int) -> decltype(a.destroy(p))
 {
     return a.destroy(p);
 }
@@ -262,7 +359,7 @@ allocator_traits<Alloc>::destroy_impl(A& a, // NOLINT(runtime/references)
 template<class Alloc>
 template<typename T>
 constexpr void
-allocator_traits<Alloc>::destroy_impl(Alloc&, T* p)
+allocator_traits<Alloc>::destroy_impl(Alloc&, T* p, ...)
 {
     p->~T();
 }
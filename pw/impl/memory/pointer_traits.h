@@ -10,10 +10,18 @@ namespace pw {
 /**
  * The generic template that is used for smart ptrs.
  *
- * The specialization for <Type *> is for real ptrs.
+ * It has no members when Ptr's element_type can't be worked out so
+ * it is safe to ask about any type, e.g. in to_address().  The
+ * specialization for <Type *> is for real ptrs.
  */
 template<class Ptr>
 struct pointer_traits
+{
+};
+
+template<class Ptr>
+    requires internal::has_element_type_v<Ptr>
+struct pointer_traits<Ptr>
 {
     using pointer         = Ptr;
     using element_type    = internal::element_type<Ptr>::type;
@@ -39,7 +47,40 @@ struct pointer_traits<Type*>
     using rebind = U*;
 
     static pointer pointer_to(element_type& r) noexcept { return addressof(r); }
+
+    static constexpr element_type* to_address(pointer p) noexcept { return p; }
 };
 
+/**
+ * The address a pointer, fancy pointer or contiguous iterator refers
+ * to.  Nothing is dereferenced so it is fine for end().
+ *
+ * @param ptr A raw pointer, which is returned as is
+ */
+template<class Type>
+constexpr Type*
+to_address(Type* ptr) noexcept
+{
+    return ptr;
+}
+
+/**
+ * @param ptr A fancy pointer or iterator: pointer_traits<Ptr>::to_address()
+ *            if it has one, otherwise the result of its operator->()
+ */
+template<class Ptr>
+constexpr auto
+to_address(Ptr const& ptr) noexcept
+{
+    if constexpr (requires { pointer_traits<Ptr>::to_address(ptr); })
+    {
+        return pointer_traits<Ptr>::to_address(ptr);
+    }
+    else
+    {
+        return pw::to_address(ptr.operator->());
+    }
+}
+
 } // namespace pw
 #endif /* INCLUDED_PW_IMPL_POINTER_TRAITS_H */
@@ -4,6 +4,10 @@
 #include <pw/impl/memory/addressof.h>
 #include <pw/impl/memory/construct_at.h>
 #include <pw/impl/memory/destroy.h>
+#include <pw/impl/type_traits/is_constant_evaluated.h>
+#include <pw/impl/type_traits/is_move_constructible.h>
+#include <pw/impl/type_traits/remove_reference.h>
+#include <pw/internal/bitwise_copy.h>
 
 namespace pw {
 
@@ -26,13 +30,34 @@ namespace pw {
  *         Strong exception guarantee: if an exception is thrown during the
  *         initialization of any element, all previously constructed elements
  *         are destroyed and the function has no effect.
+ *
+ * Contiguous ranges of the same trivially copyable type are copied
+ * with one memmove() and there is no exception handling when the copy
+ * constructor is noexcept.
  */
 template<class InputIterator, class OutputIterator>
 constexpr void
 uninitialized_copy(InputIterator begin, InputIterator end, OutputIterator out)
 {
-    OutputIterator current = out;
+    using Value = typename remove_reference<decltype(*out)>::type;
 
+    if constexpr (internal::is_bitwise_copyable_range_v<InputIterator, OutputIterator>)
+    {
+        if (!is_constant_evaluated())
+        {
+            internal::bitwise_copy(out, begin, static_cast<size_t>(end - begin));
+            return;
+        }
+    }
+    OutputIterator current = out;
+    if constexpr (is_nothrow_constructible_v<Value, decltype(*begin)>)
+    {
+        for (; begin != end; ++begin, ++current)
+        {
+            pw::construct_at(pw::addressof(*current), *begin);
+        }
+        return;
+    }
     try
     {
         while (begin != end)
@@ -4,6 +4,9 @@
 #include <pw/impl/memory/addressof.h>
 #include <pw/impl/memory/construct_at.h>
 #include <pw/impl/memory/destroy.h>
+#include <pw/impl/type_traits/is_move_constructible.h>
+#include <pw/impl/type_traits/is_trivially_default_constructible.h>
+#include <pw/impl/type_traits/remove_reference.h>
 
 namespace pw {
 
@@ -11,9 +14,11 @@ namespace pw {
  * @brief Default-constructs objects in uninitialized storage in the given range.
  *
  * This function constructs objects of the type `Value` in the uninitialized memory
- * pointed to by the range [begin, end). Construction is performed using the
- * default constructor. If an exception is thrown during construction, all
- * objects that were already constructed are destroyed using `pw::destroy`.
+ * pointed to by the range [begin, end). Construction is performed using
+ * default-initialization (`new Value`), so a trivially default constructible
+ * Value is left with whatever bytes are in memory and nothing is done at all.
+ * If an exception is thrown during construction, all objects that were already
+ * constructed are destroyed using `pw::destroy`.
  *
  * @tparam Iterator Iterator type pointing to uninitialized storage.
  * @param begin Iterator to the beginning of the range to construct.
@@ -25,19 +30,32 @@ template<class Iterator>
 void
 uninitialized_default_construct(Iterator begin, Iterator end)
 {
-    Iterator current = begin;
-    try
+    using Value = typename remove_reference<decltype(*begin)>::type;
+
+    if constexpr (!is_trivially_default_constructible_v<Value>)
     {
-        while (current != end)
+        Iterator current = begin;
+        if constexpr (is_nothrow_constructible_v<Value>)
         {
-            pw::construct_at(pw::addressof(*current));
-            ++current;
+            for (; current != end; ++current)
+            {
+                ::new (static_cast<void*>(pw::addressof(*current))) Value;
+            }
+            return;
+        }
+        try
+        {
+            while (current != end)
+            {
+                ::new (static_cast<void*>(pw::addressof(*current))) Value;
+                ++current;
+            }
+        }
+        catch (...)
+        {
+            pw::destroy(begin, current);
+            throw;
         }
-    }
-    catch (...)
-    {
-        pw::destroy(begin, current);
-        throw;
     }
 }
 } // namespace pw
@@ -4,6 +4,9 @@
 #include <pw/impl/memory/addressof.h>
 #include <pw/impl/memory/construct_at.h>
 #include <pw/impl/memory/destroy.h>
+#include <pw/impl/type_traits/is_move_constructible.h>
+#include <pw/impl/type_traits/remove_reference.h>
+#include <pw/internal/bitwise_copy.h>
 
 namespace pw {
 
@@ -24,12 +27,32 @@ namespace pw {
  * @throws Any exception thrown by Type's copy constructor.
  *         Strong exception guarantee: if an exception is thrown, all constructed
  *         elements are destroyed and the function has no effect.
+ *
+ * A contiguous range of a trivially copyable type is filled with
+ * memset() or a loop of broadcast stores (see internal::bitwise_fill())
+ * and there is no exception handling when the copy constructor is
+ * noexcept.
  */
 template<class Iterator, class Type>
 void
 uninitialized_fill(Iterator begin, Iterator end, Type const& value)
 {
+    using Value = typename remove_reference<decltype(*begin)>::type;
+
+    if constexpr (internal::is_bitwise_fillable_v<Iterator, Type>)
+    {
+        internal::bitwise_fill(begin, static_cast<size_t>(end - begin), value);
+        return;
+    }
     Iterator current = begin;
+    if constexpr (is_nothrow_constructible_v<Value, Type const&>)
+    {
+        for (; current != end; ++current)
+        {
+            construct_at(addressof(*current), value);
+        }
+        return;
+    }
     try
     {
         while (current != end)
@@ -4,7 +4,10 @@
 #include <pw/impl/memory/addressof.h>
 #include <pw/impl/memory/construct_at.h>
 #include <pw/impl/memory/destroy.h>
+#include <pw/impl/type_traits/is_move_constructible.h>
+#include <pw/impl/type_traits/remove_reference.h>
 #include <pw/impl/utility/move.h>
+#include <pw/internal/bitwise_copy.h>
 
 namespace pw {
 
@@ -31,18 +34,36 @@ namespace pw {
  *
  * @note After the operation, elements in the source range will be in a valid but
  *       unspecified state, as they have been moved from.
+ *
+ * Contiguous ranges of the same trivially copyable type are copied
+ * with one memmove() and there is no exception handling when the move
+ * constructor is noexcept.
  */
 template<class InputIterator, class OutputIterator>
 OutputIterator
 uninitialized_move(InputIterator begin, InputIterator end, OutputIterator out)
 {
-    OutputIterator current = out;
+    using Value = typename remove_reference<decltype(*out)>::type;
 
+    if constexpr (internal::is_bitwise_copyable_range_v<InputIterator, OutputIterator>)
+    {
+        internal::bitwise_copy(out, begin, static_cast<size_t>(end - begin));
+        return out + (end - begin);
+    }
+    OutputIterator current = out;
+    if constexpr (is_nothrow_constructible_v<Value, decltype(pw::move(*begin))>)
+    {
+        for (; begin != end; ++begin, ++current)
+        {
+            construct_at(addressof(*current), pw::move(*begin));
+        }
+        return current;
+    }
     try
     {
         while (begin != end)
         {
-            construct_at(addressof(*current), move(*begin));
+            construct_at(addressof(*current), pw::move(*begin));
             ++current;
             ++begin;
         }
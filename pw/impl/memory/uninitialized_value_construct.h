@@ -4,13 +4,50 @@
 #include <pw/impl/memory/addressof.h>
 #include <pw/impl/memory/construct_at.h>
 #include <pw/impl/memory/destroy.h>
+#include <pw/impl/type_traits/is_move_constructible.h>
+#include <pw/impl/type_traits/is_trivially_default_constructible.h>
+#include <pw/impl/type_traits/remove_reference.h>
+#include <pw/internal/bitwise_copy.h>
 
 namespace pw {
+
+/**
+ * @brief Value-constructs objects in uninitialized storage in the given range.
+ *
+ * Constructs a `Value()` at each location in [begin, end).  If an exception
+ * is thrown during construction, all objects that were already constructed
+ * are destroyed using `pw::destroy`.
+ *
+ * A contiguous range of a trivially default constructible and trivially
+ * copyable type is filled with copies of `Value()` using
+ * internal::bitwise_fill(): for arithmetic types and plain structs of
+ * them that is a single memset(0).
+ *
+ * @tparam Iterator Iterator type pointing to uninitialized storage.
+ * @param begin Iterator to the beginning of the range to construct.
+ * @param end Iterator to the end of the range to construct.
+ */
 template<class Iterator>
 void
 uninitialized_value_construct(Iterator begin, Iterator end)
 {
+    using Value = typename remove_reference<decltype(*begin)>::type;
+
+    if constexpr (is_trivially_default_constructible_v<Value> &&
+                  internal::is_bitwise_fillable_v<Iterator, Value>)
+    {
+        internal::bitwise_fill(begin, static_cast<size_t>(end - begin), Value());
+        return;
+    }
     Iterator current = begin;
+    if constexpr (is_nothrow_constructible_v<Value>)
+    {
+        for (; current != end; ++current)
+        {
+            pw::construct_at(pw::addressof(*current));
+        }
+        return;
+    }
     try
     {
         while (current != end)
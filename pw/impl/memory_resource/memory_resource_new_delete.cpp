@@ -1,19 +1,34 @@
 #include <pw/impl/memory_resource/memory_resource_new_delete.h>
 
+#include <new>
+
 namespace pw::internal {
 
 memory_resource_new_delete::~memory_resource_new_delete() noexcept
 {
 }
 
+/**
+ * Uses the aligned operator new when alignment is more than plain
+ * operator new guarantees.
+ */
 void*
 memory_resource_new_delete::do_allocate(size_t bytes, size_t alignment)
 {
+    if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        return operator new(bytes, std::align_val_t { alignment });
+    }
     return operator new(bytes);
 }
 void
 memory_resource_new_delete::do_deallocate(void* p, size_t bytes, size_t alignment)
 {
+    if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        operator delete(p, std::align_val_t { alignment });
+        return;
+    }
     operator delete(p);
 }
 
@@ -0,0 +1,93 @@
+#ifndef INCLUDED_PW_PMR_ARENA_ALLOCATOR_H
+#define INCLUDED_PW_PMR_ARENA_ALLOCATOR_H
+
+#include <pw/impl/cstddef/size.h>
+#include <pw/impl/memory_resource/pmr_arena_resource.h>
+#include <pw/impl/type_traits/bool_type.h>
+
+namespace pw {
+template<class Type, class Allocator>
+class vector;
+} // namespace pw
+
+namespace pw::pmr {
+
+/**
+ * An allocator that takes memory from an arena_resource and never
+ * gives it back; the arena frees it all at once.
+ *
+ * `bulk_release` tells Storage that deallocate() is a no-op so it can
+ * skip calling it, and with no destroy() of its own, trivially
+ * destructible elements aren't visited at all when a container goes
+ * away.
+ */
+template<class Type>
+class arena_allocator
+{
+public:
+    using value_type   = Type;
+    using bulk_release = true_type;
+
+    arena_allocator(arena_resource* arena) noexcept;
+    template<class U>
+    arena_allocator(arena_allocator<U> const& other) noexcept;
+
+    [[nodiscard]] Type* allocate(size_t count);
+    void                deallocate(Type* ptr, size_t count) noexcept;
+    arena_resource*     resource() const noexcept;
+
+    friend bool operator==(arena_allocator const& op1, arena_allocator const& op2) noexcept
+    {
+        return op1.m_arena == op2.m_arena;
+    }
+
+private:
+    arena_resource* m_arena;
+};
+
+template<class Type>
+arena_allocator<Type>::arena_allocator(arena_resource* arena) noexcept
+    : m_arena(arena)
+{
+}
+
+template<class Type>
+template<class U>
+arena_allocator<Type>::arena_allocator(arena_allocator<U> const& other) noexcept
+    : m_arena(other.resource())
+{
+}
+
+/**
+ * @exception Anything thrown by the arena's upstream resource
+ */
+template<class Type>
+Type*
+arena_allocator<Type>::allocate(size_t count)
+{
+    return static_cast<Type*>(m_arena->allocate(count * sizeof(Type), alignof(Type)));
+}
+
+/**
+ * Does nothing; the arena frees everything when it is released
+ */
+template<class Type>
+void
+arena_allocator<Type>::deallocate(Type*, size_t) noexcept
+{
+}
+
+template<class Type>
+arena_resource*
+arena_allocator<Type>::resource() const noexcept
+{
+    return m_arena;
+}
+
+/// A vector whose memory lives until its arena_resource is released;
+/// include <pw/vector> to use it
+template<class Type>
+using arena_vector = pw::vector<Type, arena_allocator<Type>>;
+
+} // namespace pw::pmr
+#endif /* INCLUDED_PW_PMR_ARENA_ALLOCATOR_H */
@@ -0,0 +1,29 @@
+#ifndef INCLUDED_PW_PMR_ARENA_RESOURCE_H
+#define INCLUDED_PW_PMR_ARENA_RESOURCE_H
+
+#include <pw/impl/memory_resource/pmr_monotonic_buffer_resource.h>
+
+namespace pw::pmr {
+
+/**
+ * The memory behind arena_allocator: a monotonic_buffer_resource that
+ * owns everything allocated from it until it is destroyed or
+ * release() is called, both of which free every chunk in one pass.
+ *
+ * Containers using arena_allocator rely on that and never hand memory
+ * back one allocation at a time.  Objects that need their destructor
+ * run must still be destroyed before the arena goes away.
+ *
+ * @code
+ * pw::pmr::arena_resource   arena;
+ * pw::pmr::arena_vector<int> v(&arena);
+ * @endcode
+ */
+class arena_resource final : public monotonic_buffer_resource
+{
+public:
+    using monotonic_buffer_resource::monotonic_buffer_resource;
+};
+
+} // namespace pw::pmr
+#endif /* INCLUDED_PW_PMR_ARENA_RESOURCE_H */
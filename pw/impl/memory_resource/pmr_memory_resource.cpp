@@ -1,7 +1,8 @@
 #include <pw/impl/memory_resource/memory_resource_new_delete.h>
 #include <pw/impl/memory_resource/memory_resource_null.h>
 #include <pw/impl/memory_resource/pmr_memory_resource.h>
-#include <pw/impl/utility/exchange.h>
+
+#include <atomic>
 
 namespace pw::pmr {
 
@@ -21,6 +22,12 @@ memory_resource::is_equal(memory_resource const& other) const noexcept
     return do_is_equal(other);
 }
 
+bool
+operator==(memory_resource const& op1, memory_resource const& op2) noexcept
+{
+    return &op1 == &op2 || op1.is_equal(op2);
+}
+
 memory_resource*
 new_delete_resource() noexcept
 {
@@ -35,17 +42,27 @@ null_memory_resource() noexcept
     return &s_resource;
 }
 
-static memory_resource* s_default_resource = new_delete_resource();
+// nullptr stands for new_delete_resource() so this is constant
+// initialized and safe to use from other static initializers
+static constinit std::atomic<memory_resource*> s_default_resource { nullptr };
 
+/**
+ * Makes r (or new_delete_resource() if r is nullptr) the default.
+ * Safe to call while other threads use get_default_resource().
+ *
+ * @return The previous default resource
+ */
 memory_resource*
 set_default_resource(memory_resource* r) noexcept
 {
-    return exchange(s_default_resource, r);
+    memory_resource* previous = s_default_resource.exchange(r, std::memory_order_acq_rel);
+    return previous ? previous : new_delete_resource();
 }
 
 memory_resource*
 get_default_resource() noexcept
 {
-    return s_default_resource;
+    memory_resource* resource = s_default_resource.load(std::memory_order_acquire);
+    return resource ? resource : new_delete_resource();
 }
 } // namespace pw::pmr
\ No newline at end of file
@@ -26,6 +26,7 @@ private:
     virtual bool  do_is_equal(memory_resource const& other) const noexcept = 0;
 };
 
+bool             operator==(memory_resource const& op1, memory_resource const& op2) noexcept;
 memory_resource* new_delete_resource() noexcept;
 memory_resource* null_memory_resource() noexcept;
 memory_resource* set_default_resource(memory_resource* r) noexcept;
@@ -0,0 +1,219 @@
+#include <pw/impl/memory_resource/pmr_mmap_resource.h>
+
+#include <cstdint>
+#include <new>
+
+#include <sys/mman.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+namespace pw::pmr {
+
+namespace {
+// From <numaif.h>, which needs libnuma's headers; the syscall doesn't
+constexpr int s_mpol_bind       = 2;
+constexpr int s_mpol_interleave = 3;
+
+size_t
+page_size() noexcept
+{
+    static size_t const s_page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    return s_page_size;
+}
+
+size_t
+round_up(size_t bytes, size_t granule) noexcept
+{
+    return (bytes + granule - 1) / granule * granule;
+}
+
+void*
+map(size_t length, int flags) noexcept
+{
+    void* p = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+    return p == MAP_FAILED ? nullptr : p;
+}
+
+/**
+ * Maps length bytes starting on a multiple of alignment by mapping
+ * extra and unmapping the ends.
+ */
+void*
+map_aligned(size_t length, size_t alignment) noexcept
+{
+    size_t const extra = alignment > page_size() ? alignment - page_size() : 0;
+    char* const  p     = static_cast<char*>(map(length + extra, 0));
+    if (p == nullptr || extra == 0)
+    {
+        return p;
+    }
+    auto const  address = reinterpret_cast<std::uintptr_t>(p);
+    char* const aligned = p + (round_up(address, alignment) - address);
+    if (aligned != p)
+    {
+        ::munmap(p, static_cast<size_t>(aligned - p));
+    }
+    if (size_t const tail = static_cast<size_t>(p + length + extra - (aligned + length)); tail > 0)
+    {
+        ::munmap(aligned + length, tail);
+    }
+    return aligned;
+}
+
+/**
+ * Asks for [p, p + length) to be placed per options.  It is only a
+ * request so failures (e.g. a kernel without NUMA) are ignored.
+ */
+void
+place(void* p, size_t length, mmap_options const& options) noexcept
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    if (options.placement != numa_placement::local && options.numa_nodes != 0)
+    {
+        int const     mode = options.placement == numa_placement::bind ? s_mpol_bind : s_mpol_interleave;
+        unsigned long mask = options.numa_nodes;
+        ::syscall(SYS_mbind, p, length, mode, &mask, sizeof(mask) * 8 + 1, 0);
+    }
+#else
+    (void)p;
+    (void)length;
+    (void)options;
+#endif
+}
+
+#if defined(MAP_HUGETLB)
+/**
+ * @return The MAP_HUGETLB flags for huge pages of size bytes
+ */
+int
+hugetlb_flags(size_t size) noexcept
+{
+    int flags = MAP_HUGETLB;
+#if defined(MAP_HUGE_SHIFT)
+    int shift = 0;
+    while ((size_t { 1 } << shift) < size)
+    {
+        ++shift;
+    }
+    flags |= shift << MAP_HUGE_SHIFT;
+#endif
+    return flags;
+}
+#endif
+} // namespace
+
+mmap_resource::mmap_resource()
+    : mmap_resource(mmap_options())
+{
+}
+
+mmap_resource::mmap_resource(mmap_options const& options)
+    : mmap_resource(options, get_default_resource())
+{
+}
+
+mmap_resource::mmap_resource(mmap_options const& options, memory_resource* upstream)
+    : m_options(options)
+    , m_upstream(upstream)
+{
+    if (m_options.huge_page_size < page_size())
+    {
+        m_options.huge_page_size = page_size();
+    }
+}
+
+mmap_resource::~mmap_resource() = default;
+
+mmap_options
+mmap_resource::options() const
+{
+    return m_options;
+}
+
+memory_resource*
+mmap_resource::upstream_resource() const
+{
+    return m_upstream;
+}
+
+/**
+ * @return true if a request is big enough and not over-aligned so it
+ *         is mapped rather than sent upstream
+ */
+bool
+mmap_resource::is_mapped(size_t bytes, size_t alignment) const noexcept
+{
+    return bytes >= m_options.threshold && bytes > 0 && alignment <= page_size();
+}
+
+/**
+ * @return bytes rounded up to whole (huge) pages
+ */
+size_t
+mmap_resource::mapped_length(size_t bytes) const noexcept
+{
+    return round_up(bytes, m_options.pages == huge_pages::none ? page_size() : m_options.huge_page_size);
+}
+
+/**
+ * Maps a new region for large requests and forwards the rest upstream.
+ *
+ * @exception std::bad_alloc if mmap() fails
+ */
+void*
+mmap_resource::do_allocate(size_t bytes, size_t alignment)
+{
+    if (!is_mapped(bytes, alignment))
+    {
+        return m_upstream->allocate(bytes, alignment);
+    }
+    size_t const length = mapped_length(bytes);
+    void*        p      = nullptr;
+#if defined(MAP_HUGETLB)
+    if (m_options.pages == huge_pages::reserved)
+    {
+        p = map(length, hugetlb_flags(m_options.huge_page_size));
+    }
+#endif
+    if (p == nullptr && m_options.pages != huge_pages::none)
+    {
+        p = map_aligned(length, m_options.huge_page_size);
+#if defined(MADV_HUGEPAGE)
+        if (p != nullptr)
+        {
+            ::madvise(p, length, MADV_HUGEPAGE);
+        }
+#endif
+    }
+    else if (p == nullptr)
+    {
+        p = map(length, 0);
+    }
+    if (p == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    place(p, length, m_options);
+    return p;
+}
+
+void
+mmap_resource::do_deallocate(void* p, size_t bytes, size_t alignment)
+{
+    if (!is_mapped(bytes, alignment))
+    {
+        m_upstream->deallocate(p, bytes, alignment);
+        return;
+    }
+    ::munmap(p, mapped_length(bytes));
+}
+
+bool
+mmap_resource::do_is_equal(memory_resource const& other) const noexcept
+{
+    return this == &other;
+}
+
+} // namespace pw::pmr
@@ -0,0 +1,107 @@
+#ifndef INCLUDED_PW_PMR_MMAP_RESOURCE_H
+#define INCLUDED_PW_PMR_MMAP_RESOURCE_H
+
+#include <pw/impl/cstddef/size.h>
+#include <pw/impl/memory_resource/pmr_memory_resource.h>
+
+namespace pw::pmr {
+
+/**
+ * How mmap_resource asks for huge pages.
+ *
+ * - none: ordinary pages
+ * - transparent: align the mapping to huge_page_size and
+ *   madvise(MADV_HUGEPAGE) so the kernel backs it with transparent
+ *   huge pages
+ * - reserved: map with MAP_HUGETLB from the reserved huge page pool,
+ *   falling back to transparent if none are available
+ */
+enum class huge_pages
+{
+    none,
+    transparent,
+    reserved,
+};
+
+/**
+ * Where mmap_resource places pages on a NUMA machine.
+ *
+ * - local: leave it to the kernel (first touch)
+ * - bind: only the nodes in numa_nodes (mbind(MPOL_BIND))
+ * - interleave: round robin across numa_nodes (mbind(MPOL_INTERLEAVE))
+ */
+enum class numa_placement
+{
+    local,
+    bind,
+    interleave,
+};
+
+/**
+ * Tuning for mmap_resource.
+ *
+ * - threshold: requests smaller than this go to the upstream resource
+ * - pages: whether to ask for huge pages
+ * - huge_page_size: the huge page size; 2 MiB on x86-64 and most
+ *   aarch64 kernels
+ * - placement: the NUMA policy
+ * - numa_nodes: bit n selects node n for bind and interleave
+ */
+struct mmap_options
+{
+    size_t         threshold      = 1024 * 1024;
+    huge_pages     pages          = huge_pages::transparent;
+    size_t         huge_page_size = 2 * 1024 * 1024;
+    numa_placement placement      = numa_placement::local;
+    unsigned long  numa_nodes     = 0;
+};
+
+/**
+ * A memory resource that maps large requests straight from the kernel
+ * with mmap() and passes small ones to an upstream resource.
+ *
+ * Very large vectors spend a lot of time on TLB misses with 4 KiB
+ * pages and on remote memory when a NUMA machine places pages badly.
+ * This resource asks for huge pages and, where the kernel supports
+ * it, binds or interleaves the mapping across NUMA nodes:
+ *
+ * @code
+ * pw::pmr::mmap_resource big({ .placement = pw::pmr::numa_placement::interleave, .numa_nodes = 0b11 });
+ * pw::pmr::vector<float> weights(&big);
+ * weights.resize(25'000'000'000);
+ * @endcode
+ *
+ * Huge pages and NUMA placement are requests: if the kernel refuses
+ * (no huge pages reserved, no NUMA support, not Linux) the memory is
+ * still mapped with ordinary pages.  Requests aligned to more than a
+ * page also go upstream.  The resource holds no state beyond its
+ * options so it may be shared between threads.
+ */
+class mmap_resource : public memory_resource
+{
+public:
+    mmap_resource();
+    explicit mmap_resource(mmap_options const& options);
+    mmap_resource(mmap_options const& options, memory_resource* upstream);
+    mmap_resource(mmap_resource const&) = delete;
+    ~mmap_resource() override;
+
+    mmap_resource& operator=(mmap_resource const&) = delete;
+
+    mmap_options     options() const;
+    memory_resource* upstream_resource() const;
+
+private:
+    bool   is_mapped(size_t bytes, size_t alignment) const noexcept;
+    size_t mapped_length(size_t bytes) const noexcept;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void  do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool  do_is_equal(memory_resource const& other) const noexcept override;
+
+    mmap_options     m_options;
+    memory_resource* m_upstream;
+};
+
+} // namespace pw::pmr
+#endif /* INCLUDED_PW_PMR_MMAP_RESOURCE_H */
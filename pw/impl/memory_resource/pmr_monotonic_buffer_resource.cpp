@@ -0,0 +1,147 @@
+#include <pw/impl/memory_resource/pmr_monotonic_buffer_resource.h>
+
+#include <pw/impl/algorithm/max.h>
+#include <pw/impl/cstddef/max_align.h>
+
+#include <new>
+
+namespace pw::pmr {
+
+/**
+ * Header at the start of each chunk from the upstream resource so
+ * release() can give it back.
+ */
+struct monotonic_buffer_resource::Chunk
+{
+    Chunk* next;
+    size_t bytes;
+    size_t alignment;
+};
+
+namespace {
+constexpr size_t s_default_size = 1024;
+
+constexpr size_t
+align_up(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+} // namespace
+
+monotonic_buffer_resource::monotonic_buffer_resource()
+    : monotonic_buffer_resource(get_default_resource())
+{
+}
+
+monotonic_buffer_resource::monotonic_buffer_resource(memory_resource* upstream)
+    : monotonic_buffer_resource(s_default_size, upstream)
+{
+}
+
+monotonic_buffer_resource::monotonic_buffer_resource(size_t initial_size)
+    : monotonic_buffer_resource(initial_size, get_default_resource())
+{
+}
+
+monotonic_buffer_resource::monotonic_buffer_resource(size_t initial_size, memory_resource* upstream)
+    : m_upstream(upstream)
+    , m_initial_buffer(nullptr)
+    , m_initial_size(0)
+    , m_next_size(max(initial_size, static_cast<size_t>(1)))
+    , m_chunks(nullptr)
+    , m_current(nullptr)
+    , m_available(0)
+{
+}
+
+monotonic_buffer_resource::monotonic_buffer_resource(void* buffer, size_t buffer_size)
+    : monotonic_buffer_resource(buffer, buffer_size, get_default_resource())
+{
+}
+
+monotonic_buffer_resource::monotonic_buffer_resource(void*            buffer,
+                                                     size_t           buffer_size,
+                                                     memory_resource* upstream)
+    : m_upstream(upstream)
+    , m_initial_buffer(buffer)
+    , m_initial_size(buffer_size)
+    , m_next_size(max(buffer_size * 2, s_default_size))
+    , m_chunks(nullptr)
+    , m_current(static_cast<char*>(buffer))
+    , m_available(buffer_size)
+{
+}
+
+monotonic_buffer_resource::~monotonic_buffer_resource()
+{
+    release();
+}
+
+/**
+ * Returns every chunk to the upstream resource and starts over with
+ * the initial buffer, if there was one.
+ */
+void
+monotonic_buffer_resource::release()
+{
+    while (m_chunks)
+    {
+        Chunk* next = m_chunks->next;
+        m_upstream->deallocate(m_chunks, m_chunks->bytes, m_chunks->alignment);
+        m_chunks = next;
+    }
+    m_current   = static_cast<char*>(m_initial_buffer);
+    m_available = m_initial_size;
+}
+
+memory_resource*
+monotonic_buffer_resource::upstream_resource() const
+{
+    return m_upstream;
+}
+
+/**
+ * Carves bytes out of the current buffer, getting a bigger chunk from
+ * upstream when it doesn't fit.
+ *
+ * @exception Anything thrown by the upstream resource
+ */
+void*
+monotonic_buffer_resource::do_allocate(size_t bytes, size_t alignment)
+{
+    size_t const padding = align_up(reinterpret_cast<size_t>(m_current), alignment) -
+                           reinterpret_cast<size_t>(m_current);
+    if (m_current == nullptr || padding + bytes > m_available)
+    {
+        size_t const chunk_alignment = max(alignment, size_t { alignof(pw::max_align_t) });
+        size_t const header          = align_up(sizeof(Chunk), chunk_alignment);
+        size_t const chunk_bytes     = max(m_next_size, header + bytes);
+
+        void* memory = m_upstream->allocate(chunk_bytes, chunk_alignment);
+        m_chunks     = ::new (memory) Chunk { m_chunks, chunk_bytes, chunk_alignment };
+        m_current    = static_cast<char*>(memory) + header;
+        m_available  = chunk_bytes - header;
+        m_next_size  = chunk_bytes * 2;
+        return do_allocate(bytes, alignment);
+    }
+    void* p = m_current + padding;
+    m_current += padding + bytes;
+    m_available -= padding + bytes;
+    return p;
+}
+
+/**
+ * Does nothing; memory is only given back by release()
+ */
+void
+monotonic_buffer_resource::do_deallocate(void*, size_t, size_t)
+{
+}
+
+bool
+monotonic_buffer_resource::do_is_equal(memory_resource const& other) const noexcept
+{
+    return this == &other;
+}
+
+} // namespace pw::pmr
@@ -0,0 +1,63 @@
+#ifndef INCLUDED_PW_PMR_MONOTONIC_BUFFER_RESOURCE_H
+#define INCLUDED_PW_PMR_MONOTONIC_BUFFER_RESOURCE_H
+
+#include <pw/impl/cstddef/size.h>
+#include <pw/impl/memory_resource/pmr_memory_resource.h>
+
+namespace pw::pmr {
+
+/**
+ * A memory resource that hands out memory by bumping a pointer and
+ * only gives it back when release() is called or it is destroyed.
+ *
+ * Memory comes from an optional initial buffer and then from chunks
+ * obtained from the upstream resource, each one larger than the last.
+ * deallocate() does nothing so a request-scoped vector can grow
+ * without a malloc()/free() round trip per step and everything goes
+ * away at once.
+ *
+ * @verbatim
+ *   m_chunks
+ *     │   ┌───────┬───────────────────────┐
+ *     └──▶│ Chunk │ used        │ free    │ ◀── m_current
+ *         └──┬────┴───────────────────────┘
+ *            │   ┌───────┬───────────┐
+ *            └──▶│ Chunk │ used      │
+ *                └───────┴───────────┘
+ * @endverbatim
+ */
+class monotonic_buffer_resource : public memory_resource
+{
+public:
+    monotonic_buffer_resource();
+    explicit monotonic_buffer_resource(memory_resource* upstream);
+    explicit monotonic_buffer_resource(size_t initial_size);
+    monotonic_buffer_resource(size_t initial_size, memory_resource* upstream);
+    monotonic_buffer_resource(void* buffer, size_t buffer_size);
+    monotonic_buffer_resource(void* buffer, size_t buffer_size, memory_resource* upstream);
+    monotonic_buffer_resource(monotonic_buffer_resource const&) = delete;
+    ~monotonic_buffer_resource() override;
+
+    monotonic_buffer_resource& operator=(monotonic_buffer_resource const&) = delete;
+
+    void             release();
+    memory_resource* upstream_resource() const;
+
+private:
+    struct Chunk;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void  do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool  do_is_equal(memory_resource const& other) const noexcept override;
+
+    memory_resource* m_upstream;
+    void*            m_initial_buffer;
+    size_t           m_initial_size;
+    size_t           m_next_size;
+    Chunk*           m_chunks;
+    char*            m_current;
+    size_t           m_available;
+};
+
+} // namespace pw::pmr
+#endif /* INCLUDED_PW_PMR_MONOTONIC_BUFFER_RESOURCE_H */
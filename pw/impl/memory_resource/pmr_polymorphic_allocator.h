@@ -2,6 +2,7 @@
 #define INCLUDED_PW_PMR_POLYMORPHIC_ALLOCATOR_H
 
 #include <pw/impl/cstddef/max_align.h>
+#include <pw/impl/memory/destroy_at.h>
 #include <pw/impl/memory/uninitialized_construct_using_allocator.h>
 #include <pw/impl/memory_resource/pmr_memory_resource.h>
 #include <pw/impl/utility/byte.h>
@@ -159,7 +160,7 @@ template<class Type>
 void
 polymorphic_allocator<StorageUnit>::destroy(Type* p)
 {
-    destroy_at(p);
+    pw::destroy_at(p);
 }
 
 template<class StorageUnit>
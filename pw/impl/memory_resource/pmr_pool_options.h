@@ -0,0 +1,23 @@
+#ifndef INCLUDED_PW_PMR_POOL_OPTIONS_H
+#define INCLUDED_PW_PMR_POOL_OPTIONS_H
+
+#include <pw/impl/cstddef/size.h>
+
+namespace pw::pmr {
+
+/**
+ * Tuning for the pool resources.  Zero means use the default.
+ *
+ * - max_blocks_per_chunk: the most blocks fetched from upstream at once
+ *   for any one pool
+ * - largest_required_pool_block: requests larger than this go directly
+ *   to the upstream resource
+ */
+struct pool_options
+{
+    size_t max_blocks_per_chunk        = 0;
+    size_t largest_required_pool_block = 0;
+};
+
+} // namespace pw::pmr
+#endif /* INCLUDED_PW_PMR_POOL_OPTIONS_H */
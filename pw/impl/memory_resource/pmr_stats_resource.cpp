@@ -0,0 +1,151 @@
+#include <pw/impl/memory_resource/pmr_stats_resource.h>
+
+#include <pw/impl/algorithm/max.h>
+
+#include <new>
+
+namespace pw::pmr {
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Sits just before each block and holds when it was allocated
+ */
+struct Header
+{
+    std::uint64_t allocated_ns;
+};
+
+// Room in front of a block for the Header that keeps the block aligned
+size_t
+header_size(size_t alignment)
+{
+    return max(alignment, size_t { 16 });
+}
+
+// Alignment asked of upstream for a block with its Header
+size_t
+block_alignment(size_t alignment)
+{
+    return max(alignment, size_t { alignof(Header) });
+}
+
+Header*
+header_of(void* p)
+{
+    return reinterpret_cast<Header*>(static_cast<char*>(p) - sizeof(Header));
+}
+
+std::uint64_t
+now_ns(Clock::time_point start)
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+}
+} // namespace
+
+stats_resource::stats_resource()
+    : stats_resource(get_default_resource())
+{
+}
+
+stats_resource::stats_resource(memory_resource* upstream)
+    : m_upstream(upstream)
+    , m_start(Clock::now())
+    , m_allocations(0)
+    , m_deallocations(0)
+    , m_bytes_allocated(0)
+    , m_bytes_in_use(0)
+    , m_peak_bytes_in_use(0)
+    , m_lifetime_ns(0)
+    , m_size_classes {}
+    , m_lifetimes {}
+{
+}
+
+stats_resource::~stats_resource() = default;
+
+/**
+ * @return A copy of every counter
+ */
+stats_snapshot
+stats_resource::snapshot() const noexcept
+{
+    stats_snapshot result {};
+
+    result.allocations       = m_allocations.load(std::memory_order_relaxed);
+    result.deallocations     = m_deallocations.load(std::memory_order_relaxed);
+    result.bytes_allocated   = m_bytes_allocated.load(std::memory_order_relaxed);
+    result.bytes_in_use      = m_bytes_in_use.load(std::memory_order_relaxed);
+    result.peak_bytes_in_use = m_peak_bytes_in_use.load(std::memory_order_relaxed);
+    result.lifetime_ns       = m_lifetime_ns.load(std::memory_order_relaxed);
+    result.seconds           = std::chrono::duration<double>(Clock::now() - m_start).count();
+    for (size_t index = 0; index < stats_snapshot::size_class_count; ++index)
+    {
+        result.size_classes[index] = m_size_classes[index].load(std::memory_order_relaxed);
+    }
+    for (size_t index = 0; index < stats_snapshot::lifetime_bucket_count; ++index)
+    {
+        result.lifetimes[index] = m_lifetimes[index].load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+memory_resource*
+stats_resource::upstream_resource() const
+{
+    return m_upstream;
+}
+
+/**
+ * Allocates bytes plus a Header from upstream and counts the request.
+ *
+ * @exception Anything thrown by the upstream resource; nothing is
+ *            counted in that case
+ */
+void*
+stats_resource::do_allocate(size_t bytes, size_t alignment)
+{
+    size_t const header = header_size(alignment);
+    void*        block  = m_upstream->allocate(bytes + header, block_alignment(alignment));
+    char*        p      = static_cast<char*>(block) + header;
+    ::new (header_of(p)) Header { now_ns(m_start) };
+
+    m_allocations.fetch_add(1, std::memory_order_relaxed);
+    m_bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+    m_size_classes[stats_snapshot::size_class_bucket(bytes)].fetch_add(1, std::memory_order_relaxed);
+
+    std::uint64_t const in_use = m_bytes_in_use.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    std::uint64_t       peak   = m_peak_bytes_in_use.load(std::memory_order_relaxed);
+    while (in_use > peak &&
+           !m_peak_bytes_in_use.compare_exchange_weak(peak, in_use, std::memory_order_relaxed))
+    {
+    }
+    return p;
+}
+
+/**
+ * Records how long the block lived and gives it back to upstream.
+ */
+void
+stats_resource::do_deallocate(void* p, size_t bytes, size_t alignment)
+{
+    size_t const        header   = header_size(alignment);
+    std::uint64_t const lifetime = now_ns(m_start) - header_of(p)->allocated_ns;
+
+    m_deallocations.fetch_add(1, std::memory_order_relaxed);
+    m_bytes_in_use.fetch_sub(bytes, std::memory_order_relaxed);
+    m_lifetime_ns.fetch_add(lifetime, std::memory_order_relaxed);
+    m_lifetimes[stats_snapshot::lifetime_bucket(lifetime)].fetch_add(1, std::memory_order_relaxed);
+
+    m_upstream->deallocate(static_cast<char*>(p) - header, bytes + header, block_alignment(alignment));
+}
+
+bool
+stats_resource::do_is_equal(memory_resource const& other) const noexcept
+{
+    return this == &other;
+}
+
+} // namespace pw::pmr
@@ -0,0 +1,64 @@
+#ifndef INCLUDED_PW_PMR_STATS_RESOURCE_H
+#define INCLUDED_PW_PMR_STATS_RESOURCE_H
+
+#include <pw/impl/cstddef/size.h>
+#include <pw/impl/memory_resource/pmr_memory_resource.h>
+#include <pw/impl/memory_resource/pmr_stats_snapshot.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace pw::pmr {
+
+/**
+ * A memory resource that forwards to an upstream resource and counts
+ * what goes through it so memory can be attributed to whoever owns
+ * the resource.
+ *
+ * @code
+ * pw::pmr::stats_resource parser_memory;
+ * pw::pmr::vector<Token>  tokens(&parser_memory);
+ * ...
+ * metrics << parser_memory.snapshot().to_prometheus("parser_memory");
+ * @endcode
+ *
+ * All counters are relaxed atomics so it may be shared between
+ * threads and read at any time.  To measure lifetimes each block
+ * carries a small header holding the time it was allocated, so
+ * upstream sees slightly larger requests than the caller made.
+ */
+class stats_resource : public memory_resource
+{
+public:
+    stats_resource();
+    explicit stats_resource(memory_resource* upstream);
+    stats_resource(stats_resource const&) = delete;
+    ~stats_resource() override;
+
+    stats_resource& operator=(stats_resource const&) = delete;
+
+    [[nodiscard]] stats_snapshot snapshot() const noexcept;
+    memory_resource*             upstream_resource() const;
+
+private:
+    using Counter = std::atomic<std::uint64_t>;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void  do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool  do_is_equal(memory_resource const& other) const noexcept override;
+
+    memory_resource*                            m_upstream;
+    std::chrono::steady_clock::time_point const m_start;
+    Counter                                     m_allocations;
+    Counter                                     m_deallocations;
+    Counter                                     m_bytes_allocated;
+    Counter                                     m_bytes_in_use;
+    Counter                                     m_peak_bytes_in_use;
+    Counter                                     m_lifetime_ns;
+    Counter                                     m_size_classes[stats_snapshot::size_class_count];
+    Counter                                     m_lifetimes[stats_snapshot::lifetime_bucket_count];
+};
+
+} // namespace pw::pmr
+#endif /* INCLUDED_PW_PMR_STATS_RESOURCE_H */
@@ -0,0 +1,122 @@
+#include <pw/impl/memory_resource/pmr_stats_snapshot.h>
+
+namespace pw::pmr {
+
+namespace {
+// Upper bound of each lifetime bucket but the last
+constexpr std::uint64_t s_lifetime_limits_ns[] = {
+    1'000,         10'000,         100'000,         1'000'000,         10'000'000,
+    100'000'000,   1'000'000'000,  10'000'000'000,  100'000'000'000,   1'000'000'000'000,
+};
+constexpr char const* s_lifetime_labels[] = { "1e-06", "1e-05", "0.0001", "0.001", "0.01",  "0.1",
+                                              "1",     "10",    "100",    "1000",  "+Inf" };
+
+static_assert(sizeof(s_lifetime_limits_ns) / sizeof(s_lifetime_limits_ns[0]) + 1 ==
+              stats_snapshot::lifetime_bucket_count);
+
+void
+append_metric(std::string&     out,
+              std::string_view name,
+              std::string_view suffix,
+              std::string_view type,
+              std::uint64_t    value)
+{
+    out.append("# TYPE ").append(name).append(suffix).append(" ").append(type).append("\n");
+    out.append(name).append(suffix).append(" ").append(std::to_string(value)).append("\n");
+}
+
+void
+append_bucket(std::string& out, std::string_view name, std::string_view le, std::uint64_t count)
+{
+    out.append(name).append("_bucket{le=\"").append(le).append("\"} ");
+    out.append(std::to_string(count)).append("\n");
+}
+} // namespace
+
+/**
+ * @return Allocations per second since the stats_resource was created
+ */
+double
+stats_snapshot::allocation_rate() const noexcept
+{
+    return seconds > 0 ? static_cast<double>(allocations) / seconds : 0.0;
+}
+
+/**
+ * Formats the snapshot in the Prometheus text exposition format with
+ * every metric name starting with name, e.g. "parser_memory":
+ *
+ * @verbatim
+ * # TYPE parser_memory_allocations_total counter
+ * parser_memory_allocations_total 1234
+ * ...
+ * # TYPE parser_memory_allocation_size_bytes histogram
+ * parser_memory_allocation_size_bytes_bucket{le="16"} 100
+ * ...
+ * @endverbatim
+ */
+std::string
+stats_snapshot::to_prometheus(std::string_view name) const
+{
+    std::string out;
+
+    append_metric(out, name, "_allocations_total", "counter", allocations);
+    append_metric(out, name, "_deallocations_total", "counter", deallocations);
+    append_metric(out, name, "_allocated_bytes_total", "counter", bytes_allocated);
+    append_metric(out, name, "_bytes_in_use", "gauge", bytes_in_use);
+    append_metric(out, name, "_peak_bytes_in_use", "gauge", peak_bytes_in_use);
+
+    std::string const sizes = std::string(name).append("_allocation_size_bytes");
+    out.append("# TYPE ").append(sizes).append(" histogram\n");
+    std::uint64_t cumulative = 0;
+    for (size_t index = 0; index + 1 < size_class_count; ++index)
+    {
+        cumulative += size_classes[index];
+        append_bucket(out, sizes, std::to_string(internal::size_class_bytes(index)), cumulative);
+    }
+    append_bucket(out, sizes, "+Inf", cumulative + size_classes[size_class_count - 1]);
+    out.append(sizes).append("_sum ").append(std::to_string(bytes_allocated)).append("\n");
+    out.append(sizes).append("_count ").append(std::to_string(allocations)).append("\n");
+
+    std::string const lifetime = std::string(name).append("_lifetime_seconds");
+    out.append("# TYPE ").append(lifetime).append(" histogram\n");
+    cumulative = 0;
+    for (size_t index = 0; index < lifetime_bucket_count; ++index)
+    {
+        cumulative += lifetimes[index];
+        append_bucket(out, lifetime, s_lifetime_labels[index], cumulative);
+    }
+    double const lifetime_seconds = static_cast<double>(lifetime_ns) / 1e9;
+    out.append(lifetime).append("_sum ").append(std::to_string(lifetime_seconds)).append("\n");
+    out.append(lifetime).append("_count ").append(std::to_string(cumulative)).append("\n");
+    return out;
+}
+
+/**
+ * @return The index into size_classes for a request of bytes
+ */
+size_t
+stats_snapshot::size_class_bucket(size_t bytes) noexcept
+{
+    if (bytes > largest_size_class)
+    {
+        return size_class_count - 1;
+    }
+    return internal::size_class_index(bytes == 0 ? 1 : bytes);
+}
+
+/**
+ * @return The index into lifetimes for a block freed after nanoseconds
+ */
+size_t
+stats_snapshot::lifetime_bucket(std::uint64_t nanoseconds) noexcept
+{
+    size_t index = 0;
+    while (index + 1 < lifetime_bucket_count && nanoseconds >= s_lifetime_limits_ns[index])
+    {
+        ++index;
+    }
+    return index;
+}
+
+} // namespace pw::pmr
@@ -0,0 +1,46 @@
+#ifndef INCLUDED_PW_PMR_STATS_SNAPSHOT_H
+#define INCLUDED_PW_PMR_STATS_SNAPSHOT_H
+
+#include <pw/impl/cstddef/size.h>
+#include <pw/internal/size_class.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace pw::pmr {
+
+/**
+ * The counters of a stats_resource at one point in time.
+ *
+ * Requests are counted per size class (see size_class()) up to 4096
+ * bytes plus one bucket for anything larger.  Lifetimes are counted
+ * in decades from 1µs to 1000s plus one bucket for anything longer.
+ * Counters are read one at a time while other threads may be
+ * allocating so they can be off from each other by a few operations.
+ */
+struct stats_snapshot
+{
+    static constexpr size_t largest_size_class    = 4096;
+    static constexpr size_t size_class_count      = internal::size_class_index(largest_size_class) + 2;
+    static constexpr size_t lifetime_bucket_count = 11;
+
+    std::uint64_t allocations;
+    std::uint64_t deallocations;
+    std::uint64_t bytes_allocated;
+    std::uint64_t bytes_in_use;
+    std::uint64_t peak_bytes_in_use;
+    std::uint64_t lifetime_ns;
+    double        seconds;
+    std::uint64_t size_classes[size_class_count];
+    std::uint64_t lifetimes[lifetime_bucket_count];
+
+    [[nodiscard]] double      allocation_rate() const noexcept;
+    [[nodiscard]] std::string to_prometheus(std::string_view name) const;
+
+    static size_t size_class_bucket(size_t bytes) noexcept;
+    static size_t lifetime_bucket(std::uint64_t nanoseconds) noexcept;
+};
+
+} // namespace pw::pmr
+#endif /* INCLUDED_PW_PMR_STATS_SNAPSHOT_H */
@@ -0,0 +1,66 @@
+#include <pw/impl/memory_resource/pmr_synchronized_pool_resource.h>
+
+namespace pw::pmr {
+
+synchronized_pool_resource::synchronized_pool_resource()
+    : synchronized_pool_resource(pool_options(), get_default_resource())
+{
+}
+
+synchronized_pool_resource::synchronized_pool_resource(memory_resource* upstream)
+    : synchronized_pool_resource(pool_options(), upstream)
+{
+}
+
+synchronized_pool_resource::synchronized_pool_resource(pool_options const& options)
+    : synchronized_pool_resource(options, get_default_resource())
+{
+}
+
+synchronized_pool_resource::synchronized_pool_resource(pool_options const& options, memory_resource* upstream)
+    : m_pools(options, upstream)
+{
+}
+
+synchronized_pool_resource::~synchronized_pool_resource() = default;
+
+void
+synchronized_pool_resource::release()
+{
+    std::lock_guard lock(m_mutex);
+    m_pools.release();
+}
+
+memory_resource*
+synchronized_pool_resource::upstream_resource() const
+{
+    return m_pools.upstream_resource();
+}
+
+pool_options
+synchronized_pool_resource::options() const
+{
+    return m_pools.options();
+}
+
+void*
+synchronized_pool_resource::do_allocate(size_t bytes, size_t alignment)
+{
+    std::lock_guard lock(m_mutex);
+    return m_pools.allocate(bytes, alignment);
+}
+
+void
+synchronized_pool_resource::do_deallocate(void* p, size_t bytes, size_t alignment)
+{
+    std::lock_guard lock(m_mutex);
+    m_pools.deallocate(p, bytes, alignment);
+}
+
+bool
+synchronized_pool_resource::do_is_equal(memory_resource const& other) const noexcept
+{
+    return this == &other;
+}
+
+} // namespace pw::pmr
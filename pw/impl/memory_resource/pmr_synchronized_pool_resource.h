@@ -0,0 +1,42 @@
+#ifndef INCLUDED_PW_PMR_SYNCHRONIZED_POOL_RESOURCE_H
+#define INCLUDED_PW_PMR_SYNCHRONIZED_POOL_RESOURCE_H
+
+#include <pw/impl/memory_resource/pmr_memory_resource.h>
+#include <pw/impl/memory_resource/pmr_pool_options.h>
+#include <pw/impl/memory_resource/pool_set.h>
+
+#include <mutex>
+
+namespace pw::pmr {
+
+/**
+ * The same as unsynchronized_pool_resource but safe to use from
+ * several threads at once.  A single mutex guards the pools.
+ */
+class synchronized_pool_resource : public memory_resource
+{
+public:
+    synchronized_pool_resource();
+    explicit synchronized_pool_resource(memory_resource* upstream);
+    explicit synchronized_pool_resource(pool_options const& options);
+    synchronized_pool_resource(pool_options const& options, memory_resource* upstream);
+    synchronized_pool_resource(synchronized_pool_resource const&) = delete;
+    ~synchronized_pool_resource() override;
+
+    synchronized_pool_resource& operator=(synchronized_pool_resource const&) = delete;
+
+    void             release();
+    memory_resource* upstream_resource() const;
+    pool_options     options() const;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void  do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool  do_is_equal(memory_resource const& other) const noexcept override;
+
+    mutable std::mutex m_mutex;
+    internal::pool_set m_pools;
+};
+
+} // namespace pw::pmr
+#endif /* INCLUDED_PW_PMR_SYNCHRONIZED_POOL_RESOURCE_H */
@@ -0,0 +1,187 @@
+#include <pw/impl/memory_resource/pmr_thread_caching_resource.h>
+
+#include <pw/internal/size_class.h>
+
+#include <atomic>
+#include <new>
+#include <thread>
+
+namespace pw::pmr {
+
+namespace {
+// Every size class is a multiple of this so blocks are aligned to it
+constexpr size_t s_block_alignment = 16;
+constexpr size_t s_largest_cached  = 4096;
+constexpr size_t s_class_count     = internal::size_class_index(s_largest_cached) + 1;
+constexpr size_t s_max_cached      = 64;
+constexpr size_t s_slot_count      = 4;
+
+// Gives every resource an id that is never reused, even if another
+// one is later created at the same address
+std::atomic<std::uint64_t> s_next_id { 1 };
+
+/**
+ * The caches this thread used last, direct mapped by resource id so
+ * finding one normally takes no lock.
+ */
+struct Slot
+{
+    std::uint64_t id;
+    void*         cache;
+};
+
+thread_local Slot t_slots[s_slot_count];
+} // namespace
+
+struct thread_caching_resource::Block
+{
+    Block* next;
+};
+
+struct thread_caching_resource::Cache
+{
+    std::thread::id owner;
+    Cache*          next;
+    Block*          free[s_class_count];
+    size_t          count[s_class_count];
+};
+
+thread_caching_resource::thread_caching_resource()
+    : thread_caching_resource(new_delete_resource())
+{
+}
+
+thread_caching_resource::thread_caching_resource(memory_resource* upstream)
+    : m_upstream(upstream)
+    , m_id(s_next_id.fetch_add(1, std::memory_order_relaxed))
+    , m_caches(nullptr)
+{
+}
+
+/**
+ * Returns every cached block and the caches themselves to upstream.
+ */
+thread_caching_resource::~thread_caching_resource()
+{
+    while (m_caches)
+    {
+        Cache* next = m_caches->next;
+        for (size_t index = 0; index < s_class_count; ++index)
+        {
+            while (Block* block = m_caches->free[index])
+            {
+                m_caches->free[index] = block->next;
+                m_upstream->deallocate(block, internal::size_class_bytes(index), s_block_alignment);
+            }
+        }
+        m_upstream->deallocate(m_caches, sizeof(Cache), alignof(Cache));
+        m_caches = next;
+    }
+}
+
+memory_resource*
+thread_caching_resource::upstream_resource() const
+{
+    return m_upstream;
+}
+
+/**
+ * @return The calling thread's cache, creating it on first use
+ */
+thread_caching_resource::Cache*
+thread_caching_resource::local_cache()
+{
+    Slot& slot = t_slots[m_id % s_slot_count];
+    if (slot.id != m_id)
+    {
+        slot.cache = find_cache();
+        slot.id    = m_id;
+    }
+    return static_cast<Cache*>(slot.cache);
+}
+
+/**
+ * Looks for the cache of this thread (or a finished thread that had
+ * the same id) under the lock, adding one if there isn't any.
+ *
+ * @exception Anything thrown by the upstream resource
+ */
+thread_caching_resource::Cache*
+thread_caching_resource::find_cache()
+{
+    std::thread::id const self = std::this_thread::get_id();
+    std::lock_guard       lock(m_mutex);
+
+    for (Cache* cache = m_caches; cache; cache = cache->next)
+    {
+        if (cache->owner == self)
+        {
+            return cache;
+        }
+    }
+    void* memory = m_upstream->allocate(sizeof(Cache), alignof(Cache));
+    m_caches     = ::new (memory) Cache { self, m_caches, {}, {} };
+    return m_caches;
+}
+
+/**
+ * Takes a block from this thread's cache if one is there, otherwise
+ * from upstream.
+ *
+ * @exception Anything thrown by the upstream resource
+ */
+void*
+thread_caching_resource::do_allocate(size_t bytes, size_t alignment)
+{
+    if (bytes > s_largest_cached || alignment > s_block_alignment)
+    {
+        return m_upstream->allocate(bytes, alignment);
+    }
+    size_t const index = internal::size_class_index(bytes == 0 ? 1 : bytes);
+    Cache*       cache = local_cache();
+    if (Block* block = cache->free[index])
+    {
+        cache->free[index] = block->next;
+        --cache->count[index];
+        return block;
+    }
+    return m_upstream->allocate(internal::size_class_bytes(index), s_block_alignment);
+}
+
+/**
+ * Keeps the block in this thread's cache unless that size class
+ * already holds enough or the cache can't be created.
+ */
+void
+thread_caching_resource::do_deallocate(void* p, size_t bytes, size_t alignment)
+{
+    if (bytes > s_largest_cached || alignment > s_block_alignment)
+    {
+        m_upstream->deallocate(p, bytes, alignment);
+        return;
+    }
+    size_t const index = internal::size_class_index(bytes == 0 ? 1 : bytes);
+    Cache*       cache = nullptr;
+    try
+    {
+        cache = local_cache();
+    }
+    catch (...)
+    {
+    }
+    if (cache == nullptr || cache->count[index] == s_max_cached)
+    {
+        m_upstream->deallocate(p, internal::size_class_bytes(index), s_block_alignment);
+        return;
+    }
+    cache->free[index] = ::new (p) Block { cache->free[index] };
+    ++cache->count[index];
+}
+
+bool
+thread_caching_resource::do_is_equal(memory_resource const& other) const noexcept
+{
+    return this == &other;
+}
+
+} // namespace pw::pmr
@@ -0,0 +1,69 @@
+#ifndef INCLUDED_PW_PMR_THREAD_CACHING_RESOURCE_H
+#define INCLUDED_PW_PMR_THREAD_CACHING_RESOURCE_H
+
+#include <pw/impl/cstddef/size.h>
+#include <pw/impl/memory_resource/pmr_memory_resource.h>
+
+#include <cstdint>
+#include <mutex>
+
+namespace pw::pmr {
+
+/**
+ * A memory resource that keeps a small cache of freed blocks for each
+ * thread in front of an upstream resource (new_delete_resource() by
+ * default).
+ *
+ * Requests up to 4096 bytes are rounded up to a size class (see
+ * size_class()).  Freed blocks go on the calling thread's free list
+ * for that class and the next allocation of the class from the same
+ * thread takes them back without locking or touching upstream.  Each
+ * list holds a bounded number of blocks; past that, and for large or
+ * over-aligned requests, memory goes straight to upstream.
+ *
+ * A block may be freed by a different thread than the one that
+ * allocated it; it simply joins the freeing thread's cache.  The
+ * caches belong to the resource and are returned to upstream when it
+ * is destroyed, so every block must be freed before then.
+ *
+ * @verbatim
+ *   m_caches              thread 1                 thread 2
+ *     │   ┌───────┬──────┬──────┬─────┐   ┌───────┬──────┬─────┐
+ *     └──▶│ Cache │  16  │  32  │ ... ├──▶│ Cache │  16  │ ... │
+ *         └───────┴──┬───┴──────┴─────┘   └───────┴──────┴─────┘
+ *                    │   ┌────┐   ┌────┐
+ *                    └──▶│    ├──▶│    ├──▶ nullptr
+ *                        └────┘   └────┘
+ * @endverbatim
+ */
+class thread_caching_resource : public memory_resource
+{
+public:
+    thread_caching_resource();
+    explicit thread_caching_resource(memory_resource* upstream);
+    thread_caching_resource(thread_caching_resource const&) = delete;
+    ~thread_caching_resource() override;
+
+    thread_caching_resource& operator=(thread_caching_resource const&) = delete;
+
+    memory_resource* upstream_resource() const;
+
+private:
+    struct Block;
+    struct Cache;
+
+    Cache* local_cache();
+    Cache* find_cache();
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void  do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool  do_is_equal(memory_resource const& other) const noexcept override;
+
+    memory_resource* m_upstream;
+    std::uint64_t    m_id;
+    std::mutex       m_mutex;
+    Cache*           m_caches;
+};
+
+} // namespace pw::pmr
+#endif /* INCLUDED_PW_PMR_THREAD_CACHING_RESOURCE_H */
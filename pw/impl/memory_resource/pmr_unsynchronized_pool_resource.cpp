@@ -0,0 +1,64 @@
+#include <pw/impl/memory_resource/pmr_unsynchronized_pool_resource.h>
+
+namespace pw::pmr {
+
+unsynchronized_pool_resource::unsynchronized_pool_resource()
+    : unsynchronized_pool_resource(pool_options(), get_default_resource())
+{
+}
+
+unsynchronized_pool_resource::unsynchronized_pool_resource(memory_resource* upstream)
+    : unsynchronized_pool_resource(pool_options(), upstream)
+{
+}
+
+unsynchronized_pool_resource::unsynchronized_pool_resource(pool_options const& options)
+    : unsynchronized_pool_resource(options, get_default_resource())
+{
+}
+
+unsynchronized_pool_resource::unsynchronized_pool_resource(pool_options const& options,
+                                                           memory_resource*    upstream)
+    : m_pools(options, upstream)
+{
+}
+
+unsynchronized_pool_resource::~unsynchronized_pool_resource() = default;
+
+void
+unsynchronized_pool_resource::release()
+{
+    m_pools.release();
+}
+
+memory_resource*
+unsynchronized_pool_resource::upstream_resource() const
+{
+    return m_pools.upstream_resource();
+}
+
+pool_options
+unsynchronized_pool_resource::options() const
+{
+    return m_pools.options();
+}
+
+void*
+unsynchronized_pool_resource::do_allocate(size_t bytes, size_t alignment)
+{
+    return m_pools.allocate(bytes, alignment);
+}
+
+void
+unsynchronized_pool_resource::do_deallocate(void* p, size_t bytes, size_t alignment)
+{
+    m_pools.deallocate(p, bytes, alignment);
+}
+
+bool
+unsynchronized_pool_resource::do_is_equal(memory_resource const& other) const noexcept
+{
+    return this == &other;
+}
+
+} // namespace pw::pmr
@@ -0,0 +1,42 @@
+#ifndef INCLUDED_PW_PMR_UNSYNCHRONIZED_POOL_RESOURCE_H
+#define INCLUDED_PW_PMR_UNSYNCHRONIZED_POOL_RESOURCE_H
+
+#include <pw/impl/memory_resource/pmr_memory_resource.h>
+#include <pw/impl/memory_resource/pmr_pool_options.h>
+#include <pw/impl/memory_resource/pool_set.h>
+
+namespace pw::pmr {
+
+/**
+ * A memory resource that keeps freed memory in pools of fixed size
+ * blocks, one pool per size class, for reuse by later allocations.
+ *
+ * Only use it from one thread at a time; see
+ * synchronized_pool_resource otherwise.
+ */
+class unsynchronized_pool_resource : public memory_resource
+{
+public:
+    unsynchronized_pool_resource();
+    explicit unsynchronized_pool_resource(memory_resource* upstream);
+    explicit unsynchronized_pool_resource(pool_options const& options);
+    unsynchronized_pool_resource(pool_options const& options, memory_resource* upstream);
+    unsynchronized_pool_resource(unsynchronized_pool_resource const&) = delete;
+    ~unsynchronized_pool_resource() override;
+
+    unsynchronized_pool_resource& operator=(unsynchronized_pool_resource const&) = delete;
+
+    void             release();
+    memory_resource* upstream_resource() const;
+    pool_options     options() const;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void  do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool  do_is_equal(memory_resource const& other) const noexcept override;
+
+    internal::pool_set m_pools;
+};
+
+} // namespace pw::pmr
+#endif /* INCLUDED_PW_PMR_UNSYNCHRONIZED_POOL_RESOURCE_H */
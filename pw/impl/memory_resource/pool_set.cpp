@@ -0,0 +1,231 @@
+#include <pw/impl/memory_resource/pool_set.h>
+
+#include <pw/impl/algorithm/max.h>
+#include <pw/impl/algorithm/min.h>
+#include <pw/internal/size_class.h>
+
+#include <new>
+
+namespace pw::internal {
+
+namespace {
+// Every size class is a multiple of this so blocks are aligned to it
+constexpr size_t s_block_alignment     = 16;
+constexpr size_t s_default_max_blocks  = 1024;
+constexpr size_t s_default_largest     = 4096;
+constexpr size_t s_limit_max_blocks    = size_t { 1 } << 20;
+constexpr size_t s_limit_largest       = size_t { 1 } << 20;
+constexpr size_t s_initial_chunk_bytes = 4096;
+
+constexpr size_t
+align_up(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Blocks in a pool's first chunk: about s_initial_chunk_bytes worth
+size_t
+initial_blocks(size_t block_size, size_t max_blocks)
+{
+    return min(max(s_initial_chunk_bytes / block_size, static_cast<size_t>(1)), max_blocks);
+}
+} // namespace
+
+struct pool_set::Block
+{
+    Block* next;
+};
+
+struct pool_set::Chunk
+{
+    Chunk* next;
+    size_t bytes;
+};
+
+struct pool_set::Large
+{
+    Large* prev;
+    Large* next;
+    size_t bytes;
+    size_t alignment;
+};
+
+struct pool_set::Pool
+{
+    size_t block_size;
+    size_t next_blocks;
+    Block* free;
+    Chunk* chunks;
+};
+
+/**
+ * Fills in defaults for the options and allocates the pools from
+ * upstream.
+ *
+ * @exception Anything thrown by the upstream resource
+ */
+pool_set::pool_set(pmr::pool_options const& options, pmr::memory_resource* upstream)
+    : m_upstream(upstream)
+    , m_options(options)
+    , m_pools(nullptr)
+    , m_pool_count(0)
+    , m_large(nullptr)
+{
+    if (m_options.max_blocks_per_chunk == 0)
+        m_options.max_blocks_per_chunk = s_default_max_blocks;
+    if (m_options.largest_required_pool_block == 0)
+        m_options.largest_required_pool_block = s_default_largest;
+    m_options.max_blocks_per_chunk = min(m_options.max_blocks_per_chunk, s_limit_max_blocks);
+    m_options.largest_required_pool_block =
+        size_class(min(max(m_options.largest_required_pool_block, s_block_alignment), s_limit_largest));
+
+    for (size_t size = s_block_alignment; size <= m_options.largest_required_pool_block;
+         size        = size_class(size + 1))
+    {
+        ++m_pool_count;
+    }
+    m_pools     = static_cast<Pool*>(m_upstream->allocate(m_pool_count * sizeof(Pool), alignof(Pool)));
+    size_t size = s_block_alignment;
+    for (size_t i = 0; i < m_pool_count; ++i, size = size_class(size + 1))
+    {
+        ::new (&m_pools[i]) Pool { size, initial_blocks(size, m_options.max_blocks_per_chunk), nullptr, nullptr };
+    }
+}
+
+pool_set::~pool_set()
+{
+    release();
+    m_upstream->deallocate(m_pools, m_pool_count * sizeof(Pool), alignof(Pool));
+}
+
+/**
+ * Takes a block from the pool for bytes, fetching a new chunk from
+ * upstream when its free list is empty.  Requests no pool can hold
+ * go to upstream.
+ *
+ * @exception Anything thrown by the upstream resource
+ */
+void*
+pool_set::allocate(size_t bytes, size_t alignment)
+{
+    Pool* pool = find(bytes, alignment);
+    if (pool == nullptr)
+    {
+        size_t const chunk_alignment = max(alignment, s_block_alignment);
+        size_t const header          = align_up(sizeof(Large), chunk_alignment);
+        void*        memory          = m_upstream->allocate(header + bytes, chunk_alignment);
+        m_large = ::new (memory) Large { nullptr, m_large, header + bytes, chunk_alignment };
+        if (m_large->next)
+            m_large->next->prev = m_large;
+        return static_cast<char*>(memory) + header;
+    }
+    if (pool->free == nullptr)
+    {
+        size_t const header = align_up(sizeof(Chunk), s_block_alignment);
+        size_t const count  = pool->next_blocks;
+        size_t const total  = header + count * pool->block_size;
+        void*        memory = m_upstream->allocate(total, s_block_alignment);
+
+        pool->chunks      = ::new (memory) Chunk { pool->chunks, total };
+        pool->next_blocks = min(count * 2, m_options.max_blocks_per_chunk);
+        char* block       = static_cast<char*>(memory) + header + count * pool->block_size;
+        for (size_t i = 0; i < count; ++i)
+        {
+            block -= pool->block_size;
+            pool->free = ::new (block) Block { pool->free };
+        }
+    }
+    Block* block = pool->free;
+    pool->free   = block->next;
+    return block;
+}
+
+/**
+ * Puts p back on its pool's free list.  The memory stays with the pool
+ * until release().
+ */
+void
+pool_set::deallocate(void* p, size_t bytes, size_t alignment)
+{
+    Pool* pool = find(bytes, alignment);
+    if (pool == nullptr)
+    {
+        size_t const chunk_alignment = max(alignment, s_block_alignment);
+        Large* large = reinterpret_cast<Large*>(static_cast<char*>(p) - align_up(sizeof(Large), chunk_alignment));
+        if (large->prev)
+            large->prev->next = large->next;
+        else
+            m_large = large->next;
+        if (large->next)
+            large->next->prev = large->prev;
+        m_upstream->deallocate(large, large->bytes, large->alignment);
+        return;
+    }
+    pool->free = ::new (p) Block { pool->free };
+}
+
+/**
+ * Gives all memory back to the upstream resource, even blocks that
+ * have not been deallocated.
+ */
+void
+pool_set::release()
+{
+    for (size_t i = 0; i < m_pool_count; ++i)
+    {
+        Pool& pool = m_pools[i];
+        while (pool.chunks)
+        {
+            Chunk* next = pool.chunks->next;
+            m_upstream->deallocate(pool.chunks, pool.chunks->bytes, s_block_alignment);
+            pool.chunks = next;
+        }
+        pool.free        = nullptr;
+        pool.next_blocks = initial_blocks(pool.block_size, m_options.max_blocks_per_chunk);
+    }
+    while (m_large)
+    {
+        Large* next = m_large->next;
+        m_upstream->deallocate(m_large, m_large->bytes, m_large->alignment);
+        m_large = next;
+    }
+}
+
+pmr::pool_options
+pool_set::options() const
+{
+    return m_options;
+}
+
+pmr::memory_resource*
+pool_set::upstream_resource() const
+{
+    return m_upstream;
+}
+
+/**
+ * @return The pool whose blocks hold bytes at alignment or nullptr if
+ *         the request is too large or over-aligned.
+ */
+pool_set::Pool*
+pool_set::find(size_t bytes, size_t alignment) const
+{
+    if (alignment > s_block_alignment || bytes > m_options.largest_required_pool_block)
+    {
+        return nullptr;
+    }
+    size_t const block_size = max(size_class(bytes), s_block_alignment);
+    size_t       low        = 0;
+    size_t       high       = m_pool_count;
+    while (low < high)
+    {
+        size_t const mid = low + (high - low) / 2;
+        if (m_pools[mid].block_size < block_size)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return &m_pools[low];
+}
+
+} // namespace pw::internal
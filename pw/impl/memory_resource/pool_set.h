@@ -0,0 +1,62 @@
+#ifndef INCLUDED_PW_INTERNAL_POOL_SET_H
+#define INCLUDED_PW_INTERNAL_POOL_SET_H
+
+#include <pw/impl/cstddef/size.h>
+#include <pw/impl/memory_resource/pmr_memory_resource.h>
+#include <pw/impl/memory_resource/pmr_pool_options.h>
+
+namespace pw::internal {
+
+/**
+ * The allocator behind unsynchronized_pool_resource and
+ * synchronized_pool_resource.
+ *
+ * There is one pool per malloc() size class (see size_class()) up to
+ * largest_required_pool_block.  Each pool carves chunks from the
+ * upstream resource into blocks of its size and keeps freed blocks on
+ * a free list.  Chunks double in size up to max_blocks_per_chunk.
+ * Larger or over-aligned requests go straight to upstream and are
+ * tracked so release() can free them too.
+ *
+ * @verbatim
+ *  m_pools
+ *  ┌─────┬─────┬─────┬─────┬─────┐
+ *  │ 16  │ 32  │ 48  │ ... │4096 │
+ *  └──┬──┴─────┴─────┴─────┴─────┘
+ *     │ free  ┌────┐   ┌────┐
+ *     └──────▶│    ├──▶│    ├──▶ nullptr
+ *             └────┘   └────┘
+ * @endverbatim
+ */
+class pool_set
+{
+public:
+    pool_set(pmr::pool_options const& options, pmr::memory_resource* upstream);
+    pool_set(pool_set const&) = delete;
+    ~pool_set();
+
+    pool_set& operator=(pool_set const&) = delete;
+
+    void*                 allocate(size_t bytes, size_t alignment);
+    void                  deallocate(void* p, size_t bytes, size_t alignment);
+    void                  release();
+    pmr::pool_options     options() const;
+    pmr::memory_resource* upstream_resource() const;
+
+private:
+    struct Block;
+    struct Chunk;
+    struct Large;
+    struct Pool;
+
+    Pool* find(size_t bytes, size_t alignment) const;
+
+    pmr::memory_resource* m_upstream;
+    pmr::pool_options     m_options;
+    Pool*                 m_pools;
+    size_t                m_pool_count;
+    Large*                m_large;
+};
+
+} // namespace pw::internal
+#endif /* INCLUDED_PW_INTERNAL_POOL_SET_H */
@@ -11,6 +11,12 @@ using is_constructible = internal::constructible<void_t<>, Type, Args...>;
 
 template<class Type, class... Args>
 inline constexpr bool is_constructible_v = is_constructible<Type, Args...>::value;
+
+template<class Type>
+using is_copy_constructible = is_constructible<Type, Type const&>;
+
+template<class Type>
+inline constexpr bool is_copy_constructible_v = is_copy_constructible<Type>::value;
 } // namespace pw
 
 #endif /* INCLUDED_PW_IMPL_IS_CONSTRUCTIBLE_H */
@@ -13,6 +13,14 @@ struct is_nothrow_constructible : integral_constant<bool, __is_nothrow_construct
 template<class Type, class... Args>
 inline constexpr bool is_nothrow_constructible_v = is_nothrow_constructible<Type, Args...>::value;
 
+template<class Type>
+struct is_nothrow_move_constructible : is_nothrow_constructible<Type, Type&&>
+{
+};
+
+template<class Type>
+inline constexpr bool is_nothrow_move_constructible_v = is_nothrow_move_constructible<Type>::value;
+
 } // namespace pw
 
 #endif /* INCLUDED_PW_IMPL_IS_MOVE_CONSTRUCTIBLE_H */
@@ -0,0 +1,19 @@
+#ifndef INCLUDED_PW_IMPL_IS_TRIVIALLY_COPYABLE_H
+#define INCLUDED_PW_IMPL_IS_TRIVIALLY_COPYABLE_H
+
+#include <pw/impl/type_traits/integral_constant.h>
+
+namespace pw {
+
+/// is_trivially_copyable
+template<class Type>
+struct is_trivially_copyable : integral_constant<bool, __is_trivially_copyable(Type)>
+{
+};
+
+template<class Type>
+inline constexpr bool is_trivially_copyable_v = is_trivially_copyable<Type>::value;
+
+} // namespace pw
+
+#endif /* INCLUDED_PW_IMPL_IS_TRIVIALLY_COPYABLE_H */
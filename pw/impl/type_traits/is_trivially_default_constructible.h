@@ -0,0 +1,19 @@
+#ifndef INCLUDED_PW_IMPL_IS_TRIVIALLY_DEFAULT_CONSTRUCTIBLE_H
+#define INCLUDED_PW_IMPL_IS_TRIVIALLY_DEFAULT_CONSTRUCTIBLE_H
+
+#include <pw/impl/type_traits/integral_constant.h>
+
+namespace pw {
+
+/// is_trivially_default_constructible
+template<class Type>
+struct is_trivially_default_constructible : integral_constant<bool, __is_trivially_constructible(Type)>
+{
+};
+
+template<class Type>
+inline constexpr bool is_trivially_default_constructible_v = is_trivially_default_constructible<Type>::value;
+
+} // namespace pw
+
+#endif /* INCLUDED_PW_IMPL_IS_TRIVIALLY_DEFAULT_CONSTRUCTIBLE_H */
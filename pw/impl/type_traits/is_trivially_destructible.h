@@ -0,0 +1,26 @@
+#ifndef INCLUDED_PW_IMPL_IS_TRIVIALLY_DESTRUCTIBLE_H
+#define INCLUDED_PW_IMPL_IS_TRIVIALLY_DESTRUCTIBLE_H
+
+#include <pw/impl/type_traits/integral_constant.h>
+
+namespace pw {
+
+/// is_trivially_destructible
+#if __has_builtin(__is_trivially_destructible)
+template<class Type>
+struct is_trivially_destructible : integral_constant<bool, __is_trivially_destructible(Type)>
+{
+};
+#else
+template<class Type>
+struct is_trivially_destructible : integral_constant<bool, __has_trivial_destructor(Type)>
+{
+};
+#endif
+
+template<class Type>
+inline constexpr bool is_trivially_destructible_v = is_trivially_destructible<Type>::value;
+
+} // namespace pw
+
+#endif /* INCLUDED_PW_IMPL_IS_TRIVIALLY_DESTRUCTIBLE_H */
@@ -0,0 +1,38 @@
+#ifndef INCLUDED_PW_IMPL_IS_TRIVIALLY_RELOCATABLE_H
+#define INCLUDED_PW_IMPL_IS_TRIVIALLY_RELOCATABLE_H
+
+#include <pw/impl/type_traits/integral_constant.h>
+#include <pw/impl/type_traits/is_trivially_copyable.h>
+
+namespace pw {
+
+/**
+ * A type is trivially relocatable if moving an object to new memory
+ * and ending the lifetime of the original is the same as copying its
+ * bytes and never running the original's destructor.
+ *
+ * Every trivially copyable type qualifies.  Other types, such as an
+ * owning handle that only nulls out its source when moved, can opt in
+ * by specializing this template:
+ *
+ * @code
+ * template<>
+ * struct pw::is_trivially_relocatable<Handle> : pw::true_type
+ * {
+ * };
+ * @endcode
+ *
+ * This is not part of the standard library; `internal::Storage` uses
+ * it to grow with a single memmove().
+ */
+template<class Type>
+struct is_trivially_relocatable : integral_constant<bool, is_trivially_copyable_v<Type>>
+{
+};
+
+template<class Type>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<Type>::value;
+
+} // namespace pw
+
+#endif /* INCLUDED_PW_IMPL_IS_TRIVIALLY_RELOCATABLE_H */
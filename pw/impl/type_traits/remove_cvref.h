@@ -0,0 +1,20 @@
+#ifndef INCLUDED_PW_IMPL_REMOVE_CVREF_H
+#define INCLUDED_PW_IMPL_REMOVE_CVREF_H
+
+#include <pw/impl/type_traits/remove_cv.h>
+#include <pw/impl/type_traits/remove_reference.h>
+
+namespace pw {
+
+/// remove_cvref
+template<class Type>
+struct remove_cvref
+{
+    typedef remove_cv_t<typename remove_reference<Type>::type> type;
+};
+
+template<class Type>
+using remove_cvref_t = remove_cvref<Type>::type;
+} // namespace pw
+
+#endif /*  INCLUDED_PW_IMPL_REMOVE_CVREF_H */
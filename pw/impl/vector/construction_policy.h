@@ -0,0 +1,55 @@
+#ifndef INCLUDED_PW_IMPL_VECTOR_CONSTRUCTION_POLICY_H
+#define INCLUDED_PW_IMPL_VECTOR_CONSTRUCTION_POLICY_H
+
+#include <pw/impl/cstddef/size.h>
+
+namespace pw {
+
+/**
+ * Construction policies decide when a vector may build its elements
+ * on more than one thread.  A policy is any type with
+ *
+ * @code
+ * static constexpr size_t parallel_bytes;
+ * @endcode
+ *
+ * Filling, copying, moving or relocating at least that many bytes of
+ * elements into uninitialized memory is split across the thread pool
+ * (see execution::par).  This covers `vector(count, value)`,
+ * `vector(count)`, the copy constructor and reallocation in reserve().
+ * vector uses `Allocator::construction_policy` if the allocator
+ * defines one and sequential_construction otherwise:
+ *
+ * @code
+ * template<class Type>
+ * struct wide_allocator : pw::allocator<Type>
+ * {
+ *     using construction_policy = pw::parallel_construction<>;
+ * };
+ * pw::vector<double, wide_allocator<double>> v(1'000'000'000, 0.0);
+ * @endcode
+ *
+ * The element constructors and the allocator's construct() and
+ * destroy() must be safe to call concurrently on different elements.
+ * If one throws the elements already built are destroyed and the
+ * first exception is rethrown so the strong exception guarantee holds.
+ */
+struct sequential_construction
+{
+    /// Never construct in parallel.  The default.
+    static constexpr size_t parallel_bytes = static_cast<size_t>(-1);
+};
+
+/**
+ * Construct in parallel once there are at least Bytes of elements.
+ */
+template<size_t Bytes = 4 * 1024 * 1024>
+struct parallel_construction
+{
+    static_assert(Bytes > 0, "parallel_construction needs a threshold");
+
+    static constexpr size_t parallel_bytes = Bytes;
+};
+
+} // namespace pw
+#endif /* INCLUDED_PW_IMPL_VECTOR_CONSTRUCTION_POLICY_H */
@@ -0,0 +1,95 @@
+#ifndef INCLUDED_PW_IMPL_VECTOR_GROWTH_POLICY_H
+#define INCLUDED_PW_IMPL_VECTOR_GROWTH_POLICY_H
+
+#include <pw/impl/cstddef/size.h>
+#include <pw/internal/size_class.h>
+
+namespace pw {
+
+/**
+ * Growth policies decide the capacity a vector asks for when it runs
+ * out of room.  A policy is any type with
+ *
+ * @code
+ * static constexpr size_t next_capacity(size_t capacity, size_t element_size) noexcept;
+ * @endcode
+ *
+ * returning a value greater than capacity.  vector uses
+ * `Allocator::growth_policy` if the allocator defines one and
+ * doubling_growth otherwise:
+ *
+ * @code
+ * template<class Type>
+ * struct lean_allocator : pw::allocator<Type>
+ * {
+ *     using growth_policy = pw::factor_growth<3, 2>;
+ * };
+ * pw::vector<int, lean_allocator<int>> v;
+ * @endcode
+ */
+template<size_t Numerator, size_t Denominator>
+struct factor_growth
+{
+    static_assert(Numerator > Denominator, "growth factor must be greater than 1");
+
+    static constexpr size_t next_capacity(size_t capacity, size_t element_size) noexcept;
+};
+
+/// Multiply capacity by 2.  The default.
+using doubling_growth = factor_growth<2, 1>;
+
+/// Multiply capacity by 1.625, the Fibonacci approximation of the golden ratio
+using golden_growth = factor_growth<13, 8>;
+
+/**
+ * Double and then round up to a whole number of pages.
+ *
+ * Suits append-heavy builders whose buffers quickly outgrow malloc()'s
+ * small size classes and end up being mmap()'d anyway.
+ */
+template<size_t PageSize = 4096>
+struct page_growth
+{
+    static constexpr size_t next_capacity(size_t capacity, size_t element_size) noexcept;
+};
+
+/**
+ * Grow by at least half again and then up to the malloc() size class
+ * (see internal::size_class()) that block would come from.
+ *
+ * Useful with allocators that don't implement allocate_at_least().
+ */
+struct size_class_growth
+{
+    static constexpr size_t next_capacity(size_t capacity, size_t element_size) noexcept;
+};
+
+template<size_t Numerator, size_t Denominator>
+constexpr size_t
+factor_growth<Numerator, Denominator>::next_capacity(size_t capacity, size_t) noexcept
+{
+    size_t const next = capacity / Denominator * Numerator + capacity % Denominator * Numerator / Denominator;
+
+    return next > capacity ? next : capacity + 1;
+}
+
+template<size_t PageSize>
+constexpr size_t
+page_growth<PageSize>::next_capacity(size_t capacity, size_t element_size) noexcept
+{
+    size_t const bytes = (doubling_growth::next_capacity(capacity, element_size) * element_size + PageSize - 1) /
+                         PageSize * PageSize;
+
+    return bytes / element_size;
+}
+
+constexpr size_t
+size_class_growth::next_capacity(size_t capacity, size_t element_size) noexcept
+{
+    size_t const next = factor_growth<3, 2>::next_capacity(capacity, element_size);
+
+    return internal::size_class(next * element_size) / element_size;
+}
+
+} // namespace pw
+#endif /* INCLUDED_PW_IMPL_VECTOR_GROWTH_POLICY_H */
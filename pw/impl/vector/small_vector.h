@@ -0,0 +1,272 @@
+#ifndef INCLUDED_PW_IMPL_VECTOR_SMALL_VECTOR_H
+#define INCLUDED_PW_IMPL_VECTOR_SMALL_VECTOR_H
+
+#include <pw/impl/allocator/allocator.h>
+#include <pw/impl/initializer_list/initializer_list.h>
+#include <pw/impl/memory/allocator_traits.h>
+#include <pw/impl/utility/move.h>
+#include <pw/impl/vector/vector_decl.h>
+#include <pw/impl/vector/vector_defn.h>
+#include <pw/internal/inline_allocator.h>
+
+namespace pw {
+
+/**
+ * A vector that keeps up to Count elements inside the object and only
+ * uses Allocator once it grows past that.
+ *
+ * It is a pw::vector whose allocator hands out the inline buffer first
+ * so every vector operation is available.  The differences are:
+ *
+ * - capacity() starts at Count
+ * - moving or swapping only steals the other buffer when neither side
+ *   is using its inline buffer and the allocators compare equal;
+ *   otherwise the elements are moved
+ * - the inline buffer is left uninitialized until elements are added
+ *
+ * @verbatim
+ *    small_vector<int, 4>
+ *   ┌────┬────┬────┬────┬────────────────────┐
+ *   │ 1  │ 2  │ 3  │    │ vector (m_storage) ├──┐
+ *   └────┴────┴────┴────┴────────────────────┘  │
+ *    ▲                                          │
+ *    └──────────────────────────────────────────┘
+ * @endverbatim
+ */
+template<class Type, size_t Count, class Allocator = allocator<Type>>
+class small_vector
+    : private internal::InlineBuffer<Type, Count>
+    , public vector<Type, internal::InlineAllocator<Type, Count, Allocator>>
+{
+    static_assert(Count > 0, "small_vector needs room for at least one element");
+
+    using Buffer = internal::InlineBuffer<Type, Count>;
+    using Base   = vector<Type, internal::InlineAllocator<Type, Count, Allocator>>;
+
+public:
+    using value_type     = Type;
+    using allocator_type = Allocator;
+    using size_type      = Base::size_type;
+
+    static constexpr size_type inline_capacity = Count;
+
+    constexpr small_vector();
+    constexpr explicit small_vector(Allocator const& alloc);
+    constexpr small_vector(size_type count, value_type const& value, Allocator const& alloc = Allocator());
+    constexpr explicit small_vector(size_type count, Allocator const& alloc = Allocator());
+    constexpr small_vector(small_vector const& copy);
+    constexpr small_vector(small_vector&& other);
+    constexpr small_vector(initializer_list<value_type> init, Allocator const& alloc = Allocator());
+
+    template<class Iterator>
+    constexpr small_vector(Iterator first, Iterator last, Allocator const& alloc = Allocator());
+
+    constexpr small_vector& operator=(small_vector const& other);
+    constexpr small_vector& operator=(small_vector&& other);
+    constexpr small_vector& operator=(initializer_list<value_type> init_list);
+    constexpr void          swap(small_vector& other);
+
+    constexpr allocator_type     get_allocator() const;
+    [[nodiscard]] constexpr bool is_inline() const noexcept;
+
+private:
+    constexpr Base::allocator_type inline_allocator(Allocator const& alloc) noexcept;
+    [[nodiscard]] constexpr bool   can_take_buffer(small_vector const& other) const;
+};
+
+template<class Type, size_t Count, class Allocator>
+constexpr void swap(small_vector<Type, Count, Allocator>& op1, small_vector<Type, Count, Allocator>& op2);
+
+// Implementation section
+template<class Type, size_t Count, class Allocator>
+constexpr small_vector<Type, Count, Allocator>::small_vector()
+    : small_vector(Allocator())
+{
+}
+
+template<class Type, size_t Count, class Allocator>
+constexpr small_vector<Type, Count, Allocator>::small_vector(Allocator const& alloc)
+    : Base(inline_allocator(alloc))
+{
+    // Uses the inline buffer so it can't throw
+    Base::reserve(Count);
+}
+
+template<class Type, size_t Count, class Allocator>
+constexpr small_vector<Type, Count, Allocator>::small_vector(size_type         count,
+                                                             value_type const& value,
+                                                             Allocator const&  alloc)
+    : Base(count, value, inline_allocator(alloc))
+{
+}
+
+template<class Type, size_t Count, class Allocator>
+constexpr small_vector<Type, Count, Allocator>::small_vector(size_type count, Allocator const& alloc)
+    : Base(count, inline_allocator(alloc))
+{
+}
+
+template<class Type, size_t Count, class Allocator>
+constexpr small_vector<Type, Count, Allocator>::small_vector(small_vector const& copy)
+    : Base(copy,
+           inline_allocator(allocator_traits<Allocator>::select_on_container_copy_construction(copy.get_allocator())))
+{
+}
+
+/**
+ * Takes other's memory if it isn't using its inline buffer, otherwise
+ * moves each element into this inline buffer.
+ *
+ * @exception Anything thrown by the move constructor of Type
+ */
+template<class Type, size_t Count, class Allocator>
+constexpr small_vector<Type, Count, Allocator>::small_vector(small_vector&& other)
+    : Base(inline_allocator(other.get_allocator()))
+{
+    if (other.is_inline())
+    {
+        Base::reserve(Count);
+        for (auto& value : other)
+        {
+            Base::emplace_back(pw::move(value));
+        }
+        other.clear();
+    }
+    else
+    {
+        Base::swap(other);
+    }
+}
+
+template<class Type, size_t Count, class Allocator>
+constexpr small_vector<Type, Count, Allocator>::small_vector(initializer_list<value_type> init,
+                                                             Allocator const&             alloc)
+    : Base(init, inline_allocator(alloc))
+{
+}
+
+template<class Type, size_t Count, class Allocator>
+template<class Iterator>
+constexpr small_vector<Type, Count, Allocator>::small_vector(Iterator         first,
+                                                             Iterator         last,
+                                                             Allocator const& alloc)
+    : Base(first, last, inline_allocator(alloc))
+{
+}
+
+template<class Type, size_t Count, class Allocator>
+constexpr small_vector<Type, Count, Allocator>&
+small_vector<Type, Count, Allocator>::operator=(small_vector const& other)
+{
+    Base::operator=(other);
+    return *this;
+}
+
+/**
+ * Takes other's memory if it isn't using its inline buffer and the
+ * allocators are equal (releasing this one first), otherwise moves
+ * each element.
+ *
+ * @exception Anything thrown by the move constructor of Type
+ */
+template<class Type, size_t Count, class Allocator>
+constexpr small_vector<Type, Count, Allocator>&
+small_vector<Type, Count, Allocator>::operator=(small_vector&& other)
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+    Base::clear();
+    if (can_take_buffer(other))
+    {
+        // Give back the inline buffer or old allocation so other's can be taken
+        Base::shrink_to_fit();
+        Base::swap(other);
+    }
+    else
+    {
+        Base::reserve(other.size());
+        for (auto& value : other)
+        {
+            Base::emplace_back(pw::move(value));
+        }
+        other.clear();
+    }
+    return *this;
+}
+
+template<class Type, size_t Count, class Allocator>
+constexpr small_vector<Type, Count, Allocator>&
+small_vector<Type, Count, Allocator>::operator=(initializer_list<value_type> init_list)
+{
+    Base::operator=(init_list);
+    return *this;
+}
+
+/**
+ * Swaps memory when neither side uses its inline buffer and the
+ * allocators are equal and elements otherwise.
+ */
+template<class Type, size_t Count, class Allocator>
+constexpr void
+small_vector<Type, Count, Allocator>::swap(small_vector& other)
+{
+    if (!is_inline() && can_take_buffer(other))
+    {
+        Base::swap(other);
+        return;
+    }
+    small_vector tmp(pw::move(other));
+    other = pw::move(*this);
+    *this = pw::move(tmp);
+}
+
+/**
+ * @return true if the elements are in the inline buffer
+ */
+template<class Type, size_t Count, class Allocator>
+constexpr bool
+small_vector<Type, Count, Allocator>::is_inline() const noexcept
+{
+    return Base::begin() == const_cast<small_vector*>(this)->Buffer::buffer();
+}
+
+/**
+ * @return The allocator used once the inline buffer is full
+ */
+template<class Type, size_t Count, class Allocator>
+constexpr small_vector<Type, Count, Allocator>::allocator_type
+small_vector<Type, Count, Allocator>::get_allocator() const
+{
+    return Base::get_allocator().upstream();
+}
+
+template<class Type, size_t Count, class Allocator>
+constexpr small_vector<Type, Count, Allocator>::Base::allocator_type
+small_vector<Type, Count, Allocator>::inline_allocator(Allocator const& alloc) noexcept
+{
+    return typename Base::allocator_type(alloc, static_cast<Buffer*>(this));
+}
+
+/**
+ * The allocator never propagates so other's memory can only be taken
+ * when it isn't the inline buffer and this upstream allocator can free
+ * it.
+ */
+template<class Type, size_t Count, class Allocator>
+constexpr bool
+small_vector<Type, Count, Allocator>::can_take_buffer(small_vector const& other) const
+{
+    return !other.is_inline() && get_allocator() == other.get_allocator();
+}
+
+template<class Type, size_t Count, class Allocator>
+constexpr void
+swap(small_vector<Type, Count, Allocator>& op1, small_vector<Type, Count, Allocator>& op2)
+{
+    op1.swap(op2);
+}
+
+} // namespace pw
+#endif /* INCLUDED_PW_IMPL_VECTOR_SMALL_VECTOR_H */
@@ -0,0 +1,146 @@
+#ifndef INCLUDED_PW_IMPL_VECTOR_STORAGE_OBSERVER_H
+#define INCLUDED_PW_IMPL_VECTOR_STORAGE_OBSERVER_H
+
+#include <pw/impl/cstddef/size.h>
+
+namespace pw {
+
+/**
+ * Something a vector did with its memory, reported to a storage
+ * observer.
+ *
+ * Observers let you see how often vectors reallocate and how much
+ * they copy so you know where a reserve() would help.  An observer is
+ * any type with
+ *
+ * @code
+ * static void record(pw::storage_event const& event) noexcept;
+ * @endcode
+ *
+ * vector uses `Allocator::storage_observer` if the allocator defines
+ * one and no_storage_observer, which compiles away entirely,
+ * otherwise:
+ *
+ * @code
+ * template<class Type>
+ * struct traced_allocator : pw::allocator<Type>
+ * {
+ *     using storage_observer = pw::storage_event_ring<>;
+ * };
+ * pw::vector<int, traced_allocator<int>> v;
+ * @endcode
+ *
+ * Nothing is recorded during constant evaluation.
+ */
+struct storage_event
+{
+    enum class kind : unsigned char
+    {
+        reallocate, ///< Moved to a new, larger buffer
+        shrink,     ///< Moved to a new, smaller buffer by shrink_to_fit()
+        relocate,   ///< count elements were memmove()'d into the new buffer
+        move,       ///< count elements were move constructed into the new buffer
+        copy,       ///< count elements were copied into the new buffer
+    };
+
+    kind   what;
+    size_t element_size;
+    size_t count;
+    size_t old_capacity;
+    size_t new_capacity;
+
+    /// Bytes of elements relocated, moved or copied
+    [[nodiscard]] constexpr size_t bytes() const noexcept { return count * element_size; }
+};
+
+/// Records nothing.  The default.
+struct no_storage_observer
+{
+    static constexpr void record(storage_event const&) noexcept {}
+};
+
+/**
+ * Keeps the last Size events of each thread in a ring buffer.
+ *
+ * Recording is a store into thread local memory with no locking.
+ * drain() hands the calling thread's events to a function, oldest
+ * first, and empties the ring.
+ */
+template<size_t Size = 1024>
+struct storage_event_ring
+{
+    static_assert(Size > 0, "storage_event_ring needs room for at least one event");
+
+    static void   record(storage_event const& event) noexcept;
+    static size_t size() noexcept;
+    static size_t dropped() noexcept;
+
+    template<class Function>
+    static void drain(Function function);
+
+private:
+    struct Ring
+    {
+        storage_event events[Size];
+        size_t        recorded;
+        size_t        drained;
+    };
+
+    static Ring& ring() noexcept;
+};
+
+template<size_t Size>
+void
+storage_event_ring<Size>::record(storage_event const& event) noexcept
+{
+    Ring& r                       = ring();
+    r.events[r.recorded++ % Size] = event;
+}
+
+/**
+ * @return The number of events drain() would pass on
+ */
+template<size_t Size>
+size_t
+storage_event_ring<Size>::size() noexcept
+{
+    Ring const& r = ring();
+    return r.recorded - r.drained < Size ? r.recorded - r.drained : Size;
+}
+
+/**
+ * @return The number of events this thread overwrote since the last
+ *         drain()
+ */
+template<size_t Size>
+size_t
+storage_event_ring<Size>::dropped() noexcept
+{
+    Ring const& r = ring();
+    return r.recorded - r.drained - size();
+}
+
+template<size_t Size>
+template<class Function>
+void
+storage_event_ring<Size>::drain(Function function)
+{
+    Ring&        r     = ring();
+    size_t const count = size();
+    for (size_t index = r.recorded - count; index != r.recorded; ++index)
+    {
+        function(r.events[index % Size]);
+    }
+    r.drained = r.recorded;
+}
+
+template<size_t Size>
+typename storage_event_ring<Size>::Ring&
+storage_event_ring<Size>::ring() noexcept
+{
+    thread_local Ring s_ring {};
+    return s_ring;
+}
+
+} // namespace pw
+#endif /* INCLUDED_PW_IMPL_VECTOR_STORAGE_OBSERVER_H */
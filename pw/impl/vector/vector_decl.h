@@ -8,6 +8,7 @@
 #include <pw/impl/memory/allocator_traits.h>
 #include <pw/impl/memory_resource/pmr_polymorphic_allocator.h>
 
+#include <pw/internal/is_iterator.h>
 #include <pw/internal/storage.h>
 
 namespace pw {
@@ -56,6 +57,7 @@ public:
                                  allocator_traits<allocator_type>::is_always_equal::value);
 
     template<class Iterator>
+        requires internal::is_iterator_v<Iterator>
     constexpr void                    assign(Iterator begin, Iterator end);
     constexpr void                    assign(size_type count, value_type const& value);
     constexpr void                    assign(initializer_list<value_type> init_list);
@@ -93,6 +95,9 @@ public:
     constexpr void                    push_back(value_type&& value);
     constexpr void                    resize(size_type total);
     constexpr void                    resize(size_type total, const_reference value);
+    constexpr void                    resize_for_overwrite(size_type total);
+    template<class Operation>
+    constexpr void                    resize_and_overwrite(size_type count, Operation op);
     constexpr iterator                erase(const_iterator position);
     constexpr iterator                erase(const_iterator begin, const_iterator end);
     constexpr void                    pop_back();
@@ -101,6 +106,7 @@ public:
     constexpr iterator                insert(const_iterator position, size_type count, const_reference value);
     constexpr iterator                insert(const_iterator position, initializer_list<value_type> init_list);
     template<class Iterator>
+        requires internal::is_iterator_v<Iterator>
     constexpr iterator insert(const_iterator position, Iterator first, Iterator last);
     template<class... Args>
     constexpr reference emplace_back(Args&&... args);
@@ -110,6 +116,11 @@ public:
 private:
     using Storage = internal::Storage<Type, Allocator>;
 
+    template<class Iterator>
+    constexpr void     assign_forward(Iterator first, Iterator last, size_type count);
+    template<class Iterator>
+    constexpr iterator insert_forward(const_iterator position, Iterator first, Iterator last, size_type count);
+
     Storage m_storage;
 };
 
@@ -127,6 +138,6 @@ constexpr auto operator<=>(vector<Type, Allocator> const& op1, vector<Type, Allo
 namespace pmr {
 template<class Type>
 using vector = vector<Type, polymorphic_allocator<Type>>;
-}
+} // namespace pmr
 } // namespace pw
 #endif /* INCLUDED_PW_IMPL_VECTOR_DECL_H */
@@ -3,11 +3,23 @@
 
 #include <pw/impl/vector/vector_decl.h>
 
+#include <pw/impl/algorithm/copy.h>
+#include <pw/impl/algorithm/equal.h>
+#include <pw/impl/algorithm/fill_n.h>
+#include <pw/impl/algorithm/max.h>
 #include <pw/impl/algorithm/min.h>
 #include <pw/impl/algorithm/move.h>
+#include <pw/impl/algorithm/rotate.h>
 #include <pw/impl/iterator/distance.h>
+#include <pw/impl/iterator/next.h>
+#include <pw/impl/memory/addressof.h>
 #include <pw/impl/memory/uninitialized_copy.h>
 #include <pw/impl/type_traits/is_base_of.h>
+#include <pw/impl/type_traits/is_constant_evaluated.h>
+#include <pw/internal/bitwise_compare.h>
+#include <pw/internal/compare.h>
+#include <pw/internal/is_iterator.h>
+#include <pw/internal/temporary_value.h>
 #include <pw/internal/unimplemented.h>
 
 namespace pw {
@@ -58,12 +70,16 @@ constexpr vector<Type, Allocator>::vector(size_type             count,
  * @param alloc The allocator to use for memory allocation
  * @return A vector containing count default-constructed elements
  * @exception std::bad_alloc if memory allocation fails
+ *
+ * Integer, pointer and floating point elements are taken from zeroed
+ * memory when the allocator has allocate_zeroed() (pw::allocator
+ * does) so nothing is written until the elements are used.
  */
 template<class Type, class Allocator>
 constexpr vector<Type, Allocator>::vector(size_type count, allocator_type const& alloc)
-    : m_storage(alloc, count)
+    : m_storage(alloc)
 {
-    m_storage.uninitialized_default_construct(m_storage.begin(), m_storage.begin() + count).set_size(count);
+    m_storage.reset_to_value_initialized(count);
 }
 
 /**
@@ -96,20 +112,27 @@ constexpr vector<Type, Allocator>::vector(vector const& copy, allocator_type con
 
 /**
  * @brief Move constructor. Takes ownership of another vector's resources.
+ *
+ * The memory is taken over without allocating or moving any elements
+ * and copy is left empty.
+ *
  * @param copy The vector to move from
  * @return A vector that has taken ownership of the moved vector's resources
  * @exception None (noexcept)
  */
 template<class Type, class Allocator>
 constexpr vector<Type, Allocator>::vector(vector&& copy) noexcept
-    : m_storage(copy.get_allocator(), copy.size())
+    : m_storage(copy.get_allocator())
 {
-    // TODO: Move constructor should move Storage and allocator
-    m_storage.uninitialized_move(copy.begin(), copy.end(), m_storage.begin()).set_size(copy.size());
+    m_storage.take_buffer(copy.m_storage);
 }
 
 /**
  * @brief Move constructor with allocator. Moves from another vector using the specified allocator.
+ *
+ * Takes over copy's memory if alloc compares equal to its allocator,
+ * otherwise allocates with alloc and moves each element.
+ *
  * @param copy The vector to move from
  * @param alloc The allocator to use for memory allocation
  * @return A vector that has taken ownership of the moved vector's resources
@@ -117,9 +140,17 @@ constexpr vector<Type, Allocator>::vector(vector&& copy) noexcept
  */
 template<class Type, class Allocator>
 constexpr vector<Type, Allocator>::vector(vector&& copy, Allocator const& alloc)
-    : m_storage(alloc, copy.size())
+    : m_storage(alloc)
 {
-    m_storage.uninitialized_move(copy.begin(), copy.end(), m_storage.begin()).set_size(copy.size());
+    if (allocator_traits<allocator_type>::is_always_equal::value || alloc == copy.get_allocator())
+    {
+        m_storage.take_buffer(copy.m_storage);
+    }
+    else
+    {
+        m_storage.reset_to(copy.size());
+        m_storage.uninitialized_move(copy.begin(), copy.end(), m_storage.begin()).set_size(copy.size());
+    }
 }
 
 /**
@@ -152,7 +183,7 @@ constexpr vector<Type, Allocator>::vector(Iterator first, Iterator last, allocat
     if constexpr (is_base_of<forward_iterator_tag,
                              typename iterator_traits<Iterator>::iterator_category>::value)
     {
-        size_type count = distance(first, last);
+        size_type count = pw::distance(first, last);
         m_storage.reset_to(count);
         m_storage.uninitialized_copy(first, last, m_storage.begin()).set_size(count);
     }
@@ -177,42 +208,26 @@ template<class Type, class Allocator>
 constexpr vector<Type, Allocator>&
 vector<Type, Allocator>::operator=(vector const& other)
 {
-    if constexpr (allocator_traits<allocator_type>::propagate_on_container_copy_assignment::value)
+    if (this == &other)
     {
-        Storage tmp { other.get_allocator(), other.size() };
-
-        tmp.uninitialized_copy(other.begin(), other.end(), tmp.begin());
-        tmp.set_size(other.size());
-        m_storage.swap(tmp);
-        m_storage.swap_allocator(tmp);
+        return *this;
     }
-    else if (m_storage.size() < other.size())
+    if constexpr (allocator_traits<allocator_type>::propagate_on_container_copy_assignment::value)
     {
-        if (m_storage.capacity() >= other.size())
+        if (!allocator_traits<allocator_type>::is_always_equal::value && get_allocator() != other.get_allocator())
         {
-            m_storage.copy(other.begin(), other.begin() + m_storage.size(), m_storage.begin());
-            m_storage.uninitialized_copy(other.begin() + m_storage.size(), other.end(), m_storage.end());
-        }
-        else
-        {
-            // Not enough space so we need to reallocate
-            Storage tmp { allocator_type(), other.size() };
+            // Our memory has to go back to our allocator so nothing can be reused
+            Storage tmp { other.get_allocator(), other.size() };
+
             tmp.uninitialized_copy(other.begin(), other.end(), tmp.begin());
             tmp.set_size(other.size());
-            m_storage.swap(tmp);
+            m_storage.replace_with(tmp);
+            m_storage.swap_allocator(tmp);
+            return *this;
         }
-        m_storage.set_size(other.size());
-    }
-    else if (m_storage.size() == other.size())
-    {
-        m_storage.copy(other.begin(), other.end(), m_storage.begin());
-    }
-    else // m_storage.size() > other.size()
-    {
-        m_storage.copy(other.begin(), other.end(), m_storage.begin());
-        m_storage.destroy(begin() + other.size(), m_storage.end());
-        m_storage.set_size(other.size());
+        m_storage.allocator() = other.get_allocator();
     }
+    assign_forward(other.begin(), other.end(), other.size());
     return *this;
 }
 
@@ -226,15 +241,18 @@ template<class Type, class Allocator>
 constexpr vector<Type, Allocator>&
 vector<Type, Allocator>::operator=(initializer_list<value_type> init_list)
 {
-    Storage tmp { allocator_type(), init_list.size() };
-
-    tmp.uninitialized_copy(init_list.begin(), init_list.end(), tmp.begin()).set_size(init_list.size());
-    m_storage.swap(tmp);
+    assign_forward(init_list.begin(), init_list.end(), init_list.size());
     return *this;
 }
 
 /**
  * @brief Move assignment operator. Moves contents from another vector.
+ *
+ * If the allocator propagates or the allocators compare equal this
+ * frees the current memory and takes over other's, leaving other
+ * empty.  Otherwise the elements are moved one at a time into memory
+ * from this vector's allocator.
+ *
  * @param other The vector to move from
  * @return Reference to this vector
  * @exception None (conditionally noexcept based on allocator traits)
@@ -245,12 +263,24 @@ vector<Type, Allocator>::operator=(vector&& other)
     noexcept(allocator_traits<allocator_type>::propagate_on_container_move_assignment::value ||
              allocator_traits<allocator_type>::is_always_equal::value)
 {
+    if (this == &other)
+    {
+        return *this;
+    }
     if constexpr (allocator_traits<allocator_type>::propagate_on_container_move_assignment::value)
     {
-        Storage storage { other.get_allocator(), other.size() };
-        storage.uninitialized_move(other.begin(), other.end(), storage.begin()).set_size(other.size());
-        m_storage.swap(storage);
-        m_storage.swap_allocator(storage);
+        m_storage.take_buffer(other.m_storage);
+        m_storage.swap_allocator(other.m_storage);
+    }
+    else if (allocator_traits<allocator_type>::is_always_equal::value || get_allocator() == other.get_allocator())
+    {
+        m_storage.take_buffer(other.m_storage);
+    }
+    else if (other.size() > capacity())
+    {
+        Storage tmp { m_storage.copy_allocator(), other.size() };
+        tmp.uninitialized_move(other.begin(), other.end(), tmp.begin()).set_size(other.size());
+        m_storage.replace_with(tmp);
     }
     else
     {
@@ -291,30 +321,43 @@ vector<Type, Allocator>::swap(vector& other)
 
 /**
  * @brief Assigns new contents from an iterator range, replacing current contents.
- * @param begin Iterator to the first element to assign
+ *
+ * Existing elements are assigned over and only the elements past the
+ * old size() are constructed.  Memory is only allocated if the range
+ * doesn't fit in capacity().
+ *
+ * @param begin Iterator to the first element to assign; not an iterator into *this
  * @param end Iterator to one past the last element to assign
  * @return None
  * @exception std::bad_alloc if memory allocation fails
  */
 template<class Type, class Allocator>
 template<class Iterator>
+    requires internal::is_iterator_v<Iterator>
 constexpr void
 vector<Type, Allocator>::assign(Iterator begin, Iterator end)
 {
-    if constexpr (is_base_of<forward_iterator_tag, Iterator>::value)
+    if constexpr (internal::is_forward_iterator_v<Iterator>)
     {
-        size_type count = distance(begin, end);
-        Storage   tmp { allocator_type(), count };
-
-        tmp.uninitialized_copy(begin, end, tmp.begin()).set_size(count);
-        m_storage.swap(tmp);
+        assign_forward(begin, end, pw::distance(begin, end));
     }
     else
     {
-        m_storage.reset_to(0);
+        pointer current = m_storage.begin();
+        while (begin != end && current != m_storage.end())
+        {
+            *current = *begin;
+            ++current;
+            ++begin;
+        }
+        if (begin == end)
+        {
+            m_storage.destroy(current, m_storage.end());
+            m_storage.set_size(current - m_storage.begin());
+        }
         while (begin != end)
         {
-            push_back(*begin);
+            emplace_back(*begin);
             ++begin;
         }
     }
@@ -322,8 +365,12 @@ vector<Type, Allocator>::assign(Iterator begin, Iterator end)
 
 /**
  * @brief Assigns count copies of value, replacing current contents.
+ *
+ * Like assign(begin, end) this overwrites the existing elements and
+ * only allocates if count is more than capacity().
+ *
  * @param count The number of elements to assign
- * @param value The value to assign to each element
+ * @param value The value to assign to each element; may be an element of *this
  * @return None
  * @exception std::bad_alloc if memory allocation fails
  */
@@ -331,9 +378,23 @@ template<class Type, class Allocator>
 constexpr void
 vector<Type, Allocator>::assign(size_type count, value_type const& value)
 {
-    Storage tmp { allocator_type(), count };
-    tmp.uninitialized_fill(tmp.begin(), tmp.begin() + count, value).set_size(count);
-    m_storage.swap(tmp);
+    if (count > capacity())
+    {
+        Storage tmp { m_storage.copy_allocator(), count };
+        tmp.uninitialized_fill(tmp.begin(), tmp.begin() + count, value).set_size(count);
+        m_storage.replace_with(tmp);
+    }
+    else if (count > size())
+    {
+        pw::fill_n(m_storage.begin(), size(), value);
+        m_storage.uninitialized_fill(m_storage.end(), m_storage.begin() + count, value).set_size(count);
+    }
+    else
+    {
+        pw::fill_n(m_storage.begin(), count, value);
+        m_storage.destroy(m_storage.begin() + count, m_storage.end());
+        m_storage.set_size(count);
+    }
 }
 
 /**
@@ -346,9 +407,44 @@ template<class Type, class Allocator>
 constexpr void
 vector<Type, Allocator>::assign(initializer_list<value_type> init_list)
 {
-    Storage tmp { allocator_type(), init_list.size() };
-    tmp.uninitialized_copy(init_list.begin(), init_list.end(), tmp.begin()).set_size(init_list.size());
-    m_storage.swap(tmp);
+    assign_forward(init_list.begin(), init_list.end(), init_list.size());
+}
+
+/**
+ * Replaces the contents with the count elements starting at first.
+ *
+ * The first min(count, size()) elements are assigned, the rest are
+ * constructed and any left over are destroyed.  A new buffer is only
+ * allocated when count is more than capacity().
+ *
+ * @param first Start of the new elements; not an iterator into *this
+ * @param last End of the new elements
+ * @param count Number of elements in [first, last)
+ * @exception std::bad_alloc if memory allocation fails
+ */
+template<class Type, class Allocator>
+template<class Iterator>
+constexpr void
+vector<Type, Allocator>::assign_forward(Iterator first, Iterator last, size_type count)
+{
+    if (count > capacity())
+    {
+        Storage tmp { m_storage.copy_allocator(), count };
+        tmp.uninitialized_copy(first, last, tmp.begin()).set_size(count);
+        m_storage.replace_with(tmp);
+    }
+    else if (count > size())
+    {
+        Iterator middle = pw::next(first, size());
+        pw::copy(first, middle, m_storage.begin());
+        m_storage.uninitialized_copy(middle, last, m_storage.end()).set_size(count);
+    }
+    else
+    {
+        pointer new_end = pw::copy(first, last, m_storage.begin());
+        m_storage.destroy(new_end, m_storage.end());
+        m_storage.set_size(count);
+    }
 }
 
 /**
@@ -710,9 +806,10 @@ vector<Type, Allocator>::shrink_to_fit()
     {
         return;
     }
-    Storage tmp(m_storage.copy_allocator(), m_storage.size());
-    tmp.uninitialized_copy(m_storage.begin(), m_storage.end(), tmp.begin()).set_size(m_storage.size());
-    m_storage.swap(tmp);
+    // Returning memory is the point so ask for exactly size() elements
+    Storage tmp(m_storage.copy_allocator(), m_storage.size(), false);
+    tmp.transfer_from(m_storage);
+    m_storage.replace_with(tmp);
 }
 
 /**
@@ -725,11 +822,11 @@ template<class Type, class Allocator>
 constexpr void
 vector<Type, Allocator>::reserve(size_type count)
 {
-    if (count <= m_storage.capacity())
+    if (count <= m_storage.capacity() || m_storage.try_expand(count))
         return;
     Storage tmp(m_storage.copy_allocator(), count);
-    tmp.uninitialized_copy(m_storage.begin(), m_storage.end(), tmp.begin()).set_size(m_storage.size());
-    m_storage.swap(tmp);
+    tmp.transfer_from(m_storage);
+    m_storage.replace_with(tmp);
 }
 
 /**
@@ -761,7 +858,7 @@ vector<Type, Allocator>::push_back(const_reference value)
     constexpr size_type count = 1;
     size_type const     total = m_storage.size() + count;
 
-    if (total <= m_storage.capacity())
+    if (total <= m_storage.capacity() || m_storage.try_expand(m_storage.calc_size(), pw::addressof(value)))
     {
         m_storage.construct(m_storage.end(), value);
     }
@@ -769,9 +866,9 @@ vector<Type, Allocator>::push_back(const_reference value)
     {
         Storage tmp(m_storage.copy_allocator(), m_storage.calc_size());
 
-        tmp.uninitialized_copy(m_storage.begin(), m_storage.end(), tmp.begin());
         tmp.construct(tmp.begin() + total - count, value);
-        m_storage.swap(tmp);
+        tmp.transfer_from(m_storage, total - count, count);
+        m_storage.replace_with(tmp);
     }
     m_storage.set_size(total);
 }
@@ -789,7 +886,7 @@ vector<Type, Allocator>::push_back(value_type&& value)
     constexpr size_type count = 1;
     size_type const     total = m_storage.size() + count;
 
-    if (total <= m_storage.capacity())
+    if (total <= m_storage.capacity() || m_storage.try_expand(m_storage.calc_size(), pw::addressof(value)))
     {
         m_storage.construct(m_storage.capacity_begin(), pw::move(value));
     }
@@ -797,9 +894,9 @@ vector<Type, Allocator>::push_back(value_type&& value)
     {
         Storage tmp(m_storage.copy_allocator(), m_storage.calc_size());
 
-        tmp.uninitialized_move(m_storage.begin(), m_storage.end(), tmp.begin());
-        tmp.construct(tmp.begin() + total - 1, pw::move(value));
-        m_storage.swap(tmp);
+        tmp.construct(tmp.begin() + total - count, pw::move(value));
+        tmp.transfer_from(m_storage, total - count, count);
+        m_storage.replace_with(tmp);
     }
     m_storage.set_size(total);
 }
@@ -822,7 +919,7 @@ vector<Type, Allocator>::resize(size_type total)
     {
         m_storage.destroy(m_storage.begin() + total, m_storage.end());
     }
-    else if (total <= m_storage.capacity())
+    else if (total <= m_storage.capacity() || m_storage.try_expand(total))
     {
         m_storage.uninitialized_default_construct(m_storage.capacity_begin(),
                                                   m_storage.capacity_begin() + total - size());
@@ -831,10 +928,11 @@ vector<Type, Allocator>::resize(size_type total)
     {
         Storage tmp(m_storage.copy_allocator(), total);
 
-        tmp.uninitialized_copy(m_storage.begin(), m_storage.end(), tmp.capacity_begin())
-            .set_size(m_storage.size());
-        tmp.uninitialized_default_construct(tmp.capacity_begin(), tmp.begin() + total);
-        m_storage.swap(tmp);
+        size_type const count = size();
+
+        tmp.uninitialized_default_construct(tmp.begin() + count, tmp.begin() + total);
+        tmp.transfer_from(m_storage, count, total - count);
+        m_storage.replace_with(tmp);
     }
     m_storage.set_size(total);
 }
@@ -858,7 +956,7 @@ vector<Type, Allocator>::resize(size_type total, const_reference value)
     {
         m_storage.destroy(m_storage.begin() + total, m_storage.end());
     }
-    else if (total <= m_storage.capacity())
+    else if (total <= m_storage.capacity() || m_storage.try_expand(total, pw::addressof(value)))
     {
         m_storage.uninitialized_fill(
             m_storage.capacity_begin(), m_storage.capacity_begin() + total - size(), value);
@@ -867,14 +965,83 @@ vector<Type, Allocator>::resize(size_type total, const_reference value)
     {
         Storage tmp(m_storage.copy_allocator(), total);
 
-        tmp.uninitialized_copy(m_storage.begin(), m_storage.end(), tmp.capacity_begin())
-            .set_size(m_storage.size());
-        tmp.uninitialized_fill(tmp.capacity_begin(), tmp.begin() + total, value);
-        m_storage.swap(tmp);
+        size_type const count = size();
+
+        tmp.uninitialized_fill(tmp.begin() + count, tmp.begin() + total, value);
+        tmp.transfer_from(m_storage, count, total - count);
+        m_storage.replace_with(tmp);
     }
     m_storage.set_size(total);
 }
 
+/**
+ * @brief Resizes the vector to contain total elements without giving the new ones a value.
+ *
+ * Use this when the new elements are about to be overwritten, e.g. by
+ * read().  For trivial types nothing is written to the new elements
+ * so their values are indeterminate until assigned.  Other types are
+ * default constructed just like resize().  Growing goes through the
+ * growth policy like push_back() so growing in steps isn't quadratic.
+ *
+ * @param total The new size of the vector
+ * @return None
+ * @exception std::bad_alloc if memory allocation fails
+ */
+template<class Type, class Allocator>
+constexpr void
+vector<Type, Allocator>::resize_for_overwrite(size_type total)
+{
+    if (total <= size())
+    {
+        resize(total);
+        return;
+    }
+    if (total > m_storage.capacity())
+    {
+        reserve(max(m_storage.calc_size(), total));
+    }
+    m_storage.uninitialized_default_init(m_storage.end(), m_storage.begin() + total).set_size(total);
+}
+
+/**
+ * @brief Resizes to count elements and lets op fill them in directly.
+ *
+ * Modeled on `basic_string::resize_and_overwrite()`.  The vector is
+ * grown with resize_for_overwrite() and then `op(data(), count)` is
+ * called.  It writes the elements it wants to keep and returns how
+ * many there are; the vector is then shrunk to that size.
+ *
+ * @code
+ * ssize_t got = 0;
+ * buffer.resize_and_overwrite(4096, [fd, &got](char* p, size_t n) {
+ *     got = ::read(fd, p, n);
+ *     return got < 0 ? 0 : got; // keep nothing on error and check got afterwards
+ * });
+ * @endcode
+ *
+ * @param count The number of elements op may write
+ * @param op Called as op(pointer, size_type) and returns the new size()
+ * @return None
+ * @exception std::bad_alloc if memory allocation fails
+ * @exception std::length_error if op returns more than count
+ * @exception Anything op throws; the vector then has count elements
+ */
+template<class Type, class Allocator>
+template<class Operation>
+constexpr void
+vector<Type, Allocator>::resize_and_overwrite(size_type count, Operation op)
+{
+    resize_for_overwrite(count);
+
+    // A negative result, e.g. -1 from read(), becomes a huge size_type
+    size_type const total = static_cast<size_type>(pw::move(op)(m_storage.begin(), count));
+    if (total > count)
+    {
+        throw std::length_error("vector::resize_and_overwrite");
+    }
+    resize(total);
+}
+
 /**
  * @brief Removes the element at the given position.
  * @param position Iterator to the element to remove
@@ -903,13 +1070,27 @@ constexpr vector<Type, Allocator>::iterator
 vector<Type, Allocator>::erase(const_iterator begin, const_iterator end)
 {
     size_type const offset = pw::distance(cbegin(), begin);
-    size_type const last   = pw::distance(cbegin(), end);
     size_type const width  = pw::distance(begin, end);
+    iterator const  first  = m_storage.begin() + offset;
+    iterator const  last   = first + width;
 
-    m_storage.move(m_storage.begin() + last, m_storage.end(), m_storage.begin() + offset);
-    m_storage.destroy(m_storage.begin() + last, m_storage.end());
+    if (width == 0)
+    {
+        return first;
+    }
+    if (Storage::trivially_relocatable && !is_constant_evaluated())
+    {
+        // Slide the tail down over the erased elements with one memmove()
+        m_storage.destroy(first, last);
+        m_storage.relocate(last, m_storage.end(), first);
+    }
+    else
+    {
+        iterator const new_end = m_storage.move(last, m_storage.end(), first);
+        m_storage.destroy(new_end, m_storage.end());
+    }
     m_storage.set_size(size() - width);
-    return m_storage.begin() + offset;
+    return first;
 }
 
 /**
@@ -955,26 +1136,41 @@ vector<Type, Allocator>::insert(const_iterator position, value_type&& value)
 
     if (total <= m_storage.capacity())
     {
-        if (position == cend())
+        iterator const gap     = m_storage.begin() + offset;
+        iterator const old_end = m_storage.end();
+
+        if (gap == old_end)
         {
-            m_storage.uninitialized_fill(
-                m_storage.capacity_begin(), m_storage.capacity_begin() + count, pw::move(value));
+            m_storage.construct(gap, pw::move(value));
+        }
+        else if (Storage::trivially_relocatable && !is_constant_evaluated())
+        {
+            m_storage.relocate(gap, old_end, gap + count);
+            try
+            {
+                m_storage.construct(gap, pw::move(value));
+            }
+            catch (...)
+            {
+                m_storage.relocate(gap + count, old_end + count, gap);
+                throw;
+            }
         }
         else
         {
-            m_storage.uninitialized_move(m_storage.end() - count, m_storage.end(), m_storage.end());
-            m_storage.move_backward(m_storage.begin() + offset, m_storage.end() - count, m_storage.end());
-            m_storage.fill_n(m_storage.begin() + offset, count, value);
+            m_storage.construct(old_end, pw::move(*(old_end - 1)));
+            m_storage.set_size(total);
+            m_storage.move_backward(gap, old_end - 1, old_end);
+            *gap = pw::move(value);
         }
     }
     else
     {
         Storage tmp(m_storage.copy_allocator(), m_storage.calc_size());
 
-        tmp.uninitialized_move(m_storage.begin() + offset, m_storage.end(), tmp.begin() + offset + count);
-        tmp.construct(tmp.begin() + offset, value);
-        tmp.uninitialized_move(m_storage.begin(), m_storage.begin() + offset, tmp.begin());
-        m_storage.swap(tmp);
+        tmp.construct(tmp.begin() + offset, pw::move(value));
+        tmp.transfer_from(m_storage, offset, count);
+        m_storage.replace_with(tmp);
     }
     m_storage.set_size(total);
     return m_storage.begin() + offset;
@@ -995,28 +1191,69 @@ vector<Type, Allocator>::insert(const_iterator position, size_type count, const_
     size_type const offset = pw::distance(cbegin(), position);
     size_type const total  = size() + count;
 
-    if (total < m_storage.capacity())
+    if (count == 0)
     {
-        if (position == cend())
+        return m_storage.begin() + offset;
+    }
+    if (total <= m_storage.capacity())
+    {
+        iterator const  gap     = m_storage.begin() + offset;
+        iterator const  old_end = m_storage.end();
+        size_type const after   = old_end - gap;
+        // value may be one of the elements that is about to move
+        const_pointer moved = pw::addressof(value);
+        if (moved >= gap && moved < old_end)
+        {
+            moved += count;
+        }
+
+        if (gap == old_end)
         {
-            m_storage.uninitialized_fill(m_storage.end(), m_storage.end() + count, value);
+            m_storage.uninitialized_fill(gap, gap + count, value);
+        }
+        else if (Storage::trivially_relocatable && !is_constant_evaluated())
+        {
+            m_storage.relocate(gap, old_end, gap + count);
+            try
+            {
+                m_storage.uninitialized_fill(gap, gap + count, *moved);
+            }
+            catch (...)
+            {
+                m_storage.relocate(gap + count, old_end + count, gap);
+                throw;
+            }
+        }
+        else if (after > count)
+        {
+            m_storage.uninitialized_move(old_end - count, old_end, old_end);
+            m_storage.set_size(total);
+            m_storage.move_backward(gap, old_end - count, old_end);
+            pw::fill_n(gap, count, *moved);
         }
         else
         {
-            m_storage.uninitialized_move(m_storage.end() - count, m_storage.end(), m_storage.end());
-            m_storage.move_backward(m_storage.begin() + offset, m_storage.end() - count, m_storage.end());
-            // TODO: Can this fill to uninitialized memory?
-            m_storage.fill_n(m_storage.begin() + offset, count, value);
+            m_storage.uninitialized_fill(old_end, gap + count, value);
+            try
+            {
+                m_storage.uninitialized_move(gap, old_end, gap + count);
+            }
+            catch (...)
+            {
+                m_storage.destroy(old_end, gap + count);
+                throw;
+            }
+            m_storage.set_size(total);
+            pw::fill_n(gap, after, *moved);
         }
     }
     else
     {
-        Storage tmp(m_storage.copy_allocator(), total);
+        Storage tmp(m_storage.copy_allocator(), max(m_storage.calc_size(), total));
 
-        tmp.uninitialized_move(m_storage.begin() + offset, m_storage.end(), tmp.begin() + offset + count);
         tmp.uninitialized_fill(tmp.begin() + offset, tmp.begin() + offset + count, value);
-        tmp.uninitialized_move(m_storage.begin(), m_storage.begin() + offset, tmp.begin());
-        m_storage.swap(tmp);
+        tmp.transfer_from(m_storage, offset, count);
+        m_storage.replace_with(tmp);
     }
     m_storage.set_size(total);
     return m_storage.begin() + offset;
@@ -1033,28 +1270,90 @@ template<class Type, class Allocator>
 constexpr vector<Type, Allocator>::iterator
 vector<Type, Allocator>::insert(const_iterator position, initializer_list<value_type> init_list)
 {
-    size_type       offset = pw::distance(cbegin(), position);
-    size_type const total  = size() + init_list.size();
+    return insert_forward(position, init_list.begin(), init_list.end(), init_list.size());
+}
 
-    if (total <= m_storage.capacity())
+/**
+ * Inserts the count elements starting at first before position.
+ *
+ * When they fit and Type is trivially relocatable the tail moves with a
+ * single memmove() and the new elements are copied into the gap.
+ * Otherwise the tail is moved and the new elements are assigned over
+ * the moved-from ones or constructed past the old end().
+ *
+ * @param position Iterator before which the elements are inserted
+ * @param first Start of the elements to insert; not an iterator into *this
+ * @param last End of the elements to insert
+ * @param count Number of elements in [first, last)
+ * @return Iterator pointing to the first inserted element
+ * @exception std::bad_alloc if memory allocation fails
+ */
+template<class Type, class Allocator>
+template<class Iterator>
+constexpr vector<Type, Allocator>::iterator
+vector<Type, Allocator>::insert_forward(const_iterator position, Iterator first, Iterator last, size_type count)
+{
+    size_type const offset = pw::distance(cbegin(), position);
+    size_type const total  = size() + count;
+
+    if (count == 0)
     {
-        m_storage.uninitialized_move(m_storage.end() - init_list.size(), m_storage.end(), m_storage.end());
-        m_storage.move_backward(
-            m_storage.begin() + offset, m_storage.end() - init_list.size(), m_storage.end());
-        m_storage.copy(init_list.begin(), init_list.end(), m_storage.begin() + offset);
+        return m_storage.begin() + offset;
     }
-    else
+    if (total <= m_storage.capacity())
     {
-        Storage tmp(m_storage.copy_allocator(), m_storage.size() + init_list.size());
+        iterator const  gap     = m_storage.begin() + offset;
+        iterator const  old_end = m_storage.end();
+        size_type const after   = old_end - gap;
 
-        tmp.uninitialized_move(m_storage.begin(), m_storage.begin() + offset, tmp.begin());
-        tmp.uninitialized_copy(init_list.begin(), init_list.end(), tmp.begin() + offset);
-        if (!m_storage.empty())
+        if (gap == old_end)
         {
-            tmp.uninitialized_move(
-                m_storage.begin() + offset, m_storage.end(), tmp.begin() + offset + init_list.size());
+            m_storage.uninitialized_copy(first, last, gap);
         }
-        m_storage.swap(tmp);
+        else if (Storage::trivially_relocatable && !is_constant_evaluated())
+        {
+            m_storage.relocate(gap, old_end, gap + count);
+            try
+            {
+                m_storage.uninitialized_copy(first, last, gap);
+            }
+            catch (...)
+            {
+                m_storage.relocate(gap + count, old_end + count, gap);
+                throw;
+            }
+        }
+        else if (after > count)
+        {
+            m_storage.uninitialized_move(old_end - count, old_end, old_end);
+            m_storage.set_size(total);
+            m_storage.move_backward(gap, old_end - count, old_end);
+            pw::copy(first, last, gap);
+        }
+        else
+        {
+            Iterator const middle = pw::next(first, after);
+            m_storage.uninitialized_copy(middle, last, old_end);
+            try
+            {
+                m_storage.uninitialized_move(gap, old_end, gap + count);
+            }
+            catch (...)
+            {
+                m_storage.destroy(old_end, gap + count);
+                throw;
+            }
+            m_storage.set_size(total);
+            pw::copy(first, middle, gap);
+        }
+    }
+    else
+    {
+        Storage tmp(m_storage.copy_allocator(), max(m_storage.calc_size(), total));
+
+        tmp.uninitialized_copy(first, last, tmp.begin() + offset);
+        tmp.transfer_from(m_storage, offset, count);
+        m_storage.replace_with(tmp);
     }
     m_storage.set_size(total);
     return m_storage.begin() + offset;
@@ -1062,6 +1361,11 @@ vector<Type, Allocator>::insert(const_iterator position, initializer_list<value_
 
 /**
  * @brief Inserts elements from range [first, last) before position.
+ *
+ * Forward iterators are counted first so there is at most one
+ * reallocation and the tail moves once.  Input iterators can only be
+ * read once so they are appended and then rotated into place.
+ *
  * @param position Iterator before which the content will be inserted
  * @param first Iterator to the first element to insert
  * @param last Iterator to one past the last element to insert
@@ -1070,18 +1374,34 @@ vector<Type, Allocator>::insert(const_iterator position, initializer_list<value_
  */
 template<class Type, class Allocator>
 template<class Iterator>
+    requires internal::is_iterator_v<Iterator>
 constexpr vector<Type, Allocator>::iterator
 vector<Type, Allocator>::insert(const_iterator position, Iterator first, Iterator last)
 {
-    size_type offset = pw::distance(cbegin(), position);
-    iterator  dest   = m_storage.begin() + offset;
-
-    while (first != last)
+    if constexpr (internal::is_forward_iterator_v<Iterator>)
     {
-        dest = insert(dest, *first) + 1;
-        ++first;
+        return insert_forward(position, first, last, pw::distance(first, last));
+    }
+    else
+    {
+        size_type const offset   = pw::distance(cbegin(), position);
+        size_type const old_size = size();
+        try
+        {
+            while (first != last)
+            {
+                emplace_back(*first);
+                ++first;
+            }
+        }
+        catch (...)
+        {
+            erase(begin() + old_size, end());
+            throw;
+        }
+        pw::rotate(begin() + offset, begin() + old_size, end());
+        return begin() + offset;
     }
-    return m_storage.begin() + offset;
 }
 
 /**
@@ -1104,9 +1424,9 @@ vector<Type, Allocator>::emplace_back(Args&&... args)
     {
         Storage tmp(m_storage.copy_allocator(), m_storage.calc_size());
 
-        tmp.uninitialized_move(m_storage.begin(), m_storage.end(), tmp.begin());
         tmp.construct(tmp.begin() + total - 1, pw::forward<Args>(args)...);
-        m_storage.swap(tmp);
+        tmp.transfer_from(m_storage, total - 1, 1);
+        m_storage.replace_with(tmp);
     }
     m_storage.set_size(total);
     return back();
@@ -1128,20 +1448,23 @@ vector<Type, Allocator>::emplace(const_iterator position, Args&&... args)
     size_type const     total  = size() + count;
     size_type const     offset = pw::distance(cbegin(), position);
 
+    if (total <= capacity() && offset != size())
+    {
+        // args may refer to elements that are about to move
+        internal::TemporaryValue<value_type, allocator_type> tmp(m_storage.allocator(), pw::forward<Args>(args)...);
+        return insert(position, pw::move(tmp.value()));
+    }
     if (total <= capacity())
     {
-        m_storage.uninitialized_move(m_storage.end() - count, m_storage.end(), m_storage.end());
-        m_storage.move_backward(m_storage.begin() + offset, m_storage.end(), m_storage.end() - count);
-        m_storage.construct(m_storage.begin() + offset, pw::forward<Args>(args)...);
+        m_storage.construct(m_storage.end(), pw::forward<Args>(args)...);
     }
     else
     {
         Storage tmp(m_storage.copy_allocator(), m_storage.calc_size());
 
-        tmp.uninitialized_move(m_storage.begin() + offset, m_storage.end(), tmp.begin() + offset + count);
         tmp.construct(tmp.begin() + offset, pw::forward<Args>(args)...);
-        tmp.uninitialized_move(m_storage.begin(), m_storage.begin() + offset, tmp.begin());
-        m_storage.swap(tmp);
+        tmp.transfer_from(m_storage, offset, count);
+        m_storage.replace_with(tmp);
     }
     m_storage.set_size(total);
     return m_storage.begin() + offset;
@@ -1176,7 +1499,7 @@ operator==(vector<Type, Allocator> const& op1, vector<Type, Allocator> const& op
     {
         return false;
     }
-    return op1 <=> op2 == 0;
+    return pw::equal(op1.begin(), op1.end(), op2.begin(), op2.end());
 }
 
 /**
@@ -1191,6 +1514,11 @@ constexpr auto
 operator<=>(vector<Type, Allocator> const& op1, vector<Type, Allocator> const& op2)
     -> decltype(op1[0] <=> op2[0])
 {
+    if constexpr (internal::is_bitwise_comparable_v<Type>)
+    {
+        // A single memcmp() based pass instead of one <=> per element
+        return internal::compare(op1.begin(), op1.end(), op2.begin(), op2.end()) <=> 0;
+    }
     for (size_t i = 0; i < min(op1.size(), op2.size()); ++i)
     {
         auto cmp = op1[i] <=> op2[i];
@@ -33,6 +33,18 @@ using alloc_size_type = typename A::size_type;
 template<typename A>
 using alloc_is_always_equal = typename A::is_always_equal;
 
+template<typename A>
+using alloc_growth_policy = typename A::growth_policy;
+
+template<typename A>
+using alloc_bulk_release = typename A::bulk_release;
+
+template<typename A>
+using alloc_storage_observer = typename A::storage_observer;
+
+template<typename A>
+using alloc_construction_policy = typename A::construction_policy;
+
 // rebind_alloc_helper: computes rebind_alloc<T> for allocator_traits.
 // Uses Alloc::rebind<U>::other if present, otherwise synthesizes via
 // rebind_first_arg (replaces the first template argument of Alloc with U).
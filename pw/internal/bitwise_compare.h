@@ -0,0 +1,157 @@
+#ifndef INCLUDED_PW_INTERNAL_BITWISE_COMPARE_H
+#define INCLUDED_PW_INTERNAL_BITWISE_COMPARE_H
+
+#include <pw/impl/algorithm/min.h>
+#include <pw/impl/cstddef/size.h>
+#include <pw/impl/memory/pointer_traits.h>
+#include <pw/impl/type_traits/bool_type.h>
+#include <pw/impl/type_traits/integral_constant.h>
+#include <pw/impl/type_traits/is_same.h>
+#include <pw/impl/type_traits/remove_cv.h>
+#include <pw/internal/is_iterator.h>
+
+namespace pw::internal {
+
+/**
+ * Type is bitwise comparable if two objects are equal exactly when
+ * their bytes are: every integral type and every pointer.  Floating
+ * point is not (0.0 == -0.0 and NaN != NaN) and neither are class
+ * types since they may have padding or their own operator==.
+ */
+template<class Type>
+struct is_bitwise_comparable : false_type
+{
+};
+
+template<class Type>
+struct is_bitwise_comparable<Type*> : true_type
+{
+};
+
+// clang-format off
+template<> struct is_bitwise_comparable<bool> : true_type {};
+template<> struct is_bitwise_comparable<char> : true_type {};
+template<> struct is_bitwise_comparable<signed char> : true_type {};
+template<> struct is_bitwise_comparable<unsigned char> : true_type {};
+template<> struct is_bitwise_comparable<wchar_t> : true_type {};
+template<> struct is_bitwise_comparable<char8_t> : true_type {};
+template<> struct is_bitwise_comparable<char16_t> : true_type {};
+template<> struct is_bitwise_comparable<char32_t> : true_type {};
+template<> struct is_bitwise_comparable<short> : true_type {};
+template<> struct is_bitwise_comparable<unsigned short> : true_type {};
+template<> struct is_bitwise_comparable<int> : true_type {};
+template<> struct is_bitwise_comparable<unsigned int> : true_type {};
+template<> struct is_bitwise_comparable<long> : true_type {};
+template<> struct is_bitwise_comparable<unsigned long> : true_type {};
+template<> struct is_bitwise_comparable<long long> : true_type {};
+template<> struct is_bitwise_comparable<unsigned long long> : true_type {};
+// clang-format on
+
+template<class Type>
+inline constexpr bool is_bitwise_comparable_v = is_bitwise_comparable<remove_cv_t<Type>>::value;
+
+/**
+ * Single byte unsigned types order the same way memcmp() does so a
+ * lexicographical compare is a single memcmp().  Wider integers don't
+ * (little endian byte order and sign bits get in the way).
+ */
+template<class Type>
+inline constexpr bool is_bitwise_orderable_v =
+    is_bitwise_comparable_v<Type> && sizeof(Type) == 1 && static_cast<remove_cv_t<Type>>(-1) > 0;
+
+/**
+ * True if Iter1 and Iter2 are contiguous iterators over the same
+ * bitwise comparable type so the range can be handed to memcmp()
+ * (after to_address()).
+ */
+template<class Iter1, class Iter2>
+struct is_bitwise_range : false_type
+{
+};
+
+template<class Iter1, class Iter2>
+    requires(is_contiguous_iterator_v<Iter1> && is_contiguous_iterator_v<Iter2>)
+struct is_bitwise_range<Iter1, Iter2>
+    : integral_constant<bool,
+                        is_same_v<remove_cv_t<iterator_element_t<Iter1>>,
+                                  remove_cv_t<iterator_element_t<Iter2>>> &&
+                            is_bitwise_comparable_v<iterator_element_t<Iter1>>>
+{
+};
+
+template<class Iter1, class Iter2>
+inline constexpr bool is_bitwise_range_v = is_bitwise_range<Iter1, Iter2>::value;
+
+/**
+ * memcmp() is already vectorized (glibc picks an SSE2, AVX2 or
+ * AVX-512 version for the running CPU) so the kernels below just hand
+ * it as many bytes as possible.
+ */
+template<class Type>
+bool
+bitwise_equal(Type const* begin1, Type const* begin2, size_t count) noexcept
+{
+    return count == 0 || __builtin_memcmp(begin1, begin2, count * sizeof(Type)) == 0;
+}
+
+/**
+ * @return The index of the first element that differs or count if
+ *         none do.
+ */
+template<class Type>
+size_t
+bitwise_mismatch(Type const* begin1, Type const* begin2, size_t count) noexcept
+{
+    // Skip equal blocks with memcmp() then find the element in the first
+    // block that isn't.
+    constexpr size_t block = 256 / sizeof(Type) > 0 ? 256 / sizeof(Type) : 1;
+
+    size_t index = 0;
+    while (count - index >= block && __builtin_memcmp(begin1 + index, begin2 + index, block * sizeof(Type)) == 0)
+    {
+        index += block;
+    }
+    while (index < count && begin1[index] == begin2[index])
+    {
+        ++index;
+    }
+    return index;
+}
+
+/**
+ * Three way lexicographical compare of [begin1, begin1 + count1) and
+ * [begin2, begin2 + count2).
+ *
+ * @return -1, 0 or 1
+ */
+template<class Type>
+int
+bitwise_compare(Type const* begin1, size_t count1, Type const* begin2, size_t count2) noexcept
+{
+    size_t const count = min(count1, count2);
+
+    if constexpr (is_bitwise_orderable_v<Type>)
+    {
+        int const result = count == 0 ? 0 : __builtin_memcmp(begin1, begin2, count);
+        if (result != 0)
+        {
+            return result < 0 ? -1 : 1;
+        }
+    }
+    else
+    {
+        size_t const index = bitwise_mismatch(begin1, begin2, count);
+        if (index < count)
+        {
+            return begin1[index] < begin2[index] ? -1 : 1;
+        }
+    }
+    if (count1 == count2)
+    {
+        return 0;
+    }
+    return count1 < count2 ? -1 : 1;
+}
+
+} // namespace pw::internal
+#endif /* INCLUDED_PW_INTERNAL_BITWISE_COMPARE_H */
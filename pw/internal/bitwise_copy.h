@@ -0,0 +1,141 @@
+#ifndef INCLUDED_PW_INTERNAL_BITWISE_COPY_H
+#define INCLUDED_PW_INTERNAL_BITWISE_COPY_H
+
+#include <pw/impl/cstddef/size.h>
+#include <pw/impl/memory/pointer_traits.h>
+#include <pw/impl/type_traits/bool_type.h>
+#include <pw/impl/type_traits/integral_constant.h>
+#include <pw/impl/type_traits/is_same.h>
+#include <pw/impl/type_traits/is_trivially_copyable.h>
+#include <pw/impl/type_traits/remove_cv.h>
+#include <pw/internal/bitwise_compare.h>
+#include <pw/internal/is_iterator.h>
+
+namespace pw::internal {
+
+/**
+ * True if From and To are contiguous iterators over the same trivially
+ * copyable type, To's elements aren't const and neither is volatile,
+ * so assigning one range to the other is the same as copying the
+ * bytes with memmove().
+ */
+template<class From, class To>
+struct is_bitwise_copyable_range : false_type
+{
+};
+
+template<class From, class To>
+    requires(is_contiguous_iterator_v<From> && is_contiguous_iterator_v<To>)
+struct is_bitwise_copyable_range<From, To>
+    : integral_constant<bool,
+                        (is_same_v<iterator_element_t<From>, iterator_element_t<To>> ||
+                         is_same_v<iterator_element_t<From>, iterator_element_t<To> const>) &&
+                            is_same_v<iterator_element_t<To>, remove_cv_t<iterator_element_t<To>>> &&
+                            is_trivially_copyable_v<iterator_element_t<To>>>
+{
+};
+
+template<class From, class To>
+inline constexpr bool is_bitwise_copyable_range_v = is_bitwise_copyable_range<From, To>::value;
+
+/**
+ * True if filling a range through To with a Value is the same as
+ * storing copies of one converted Value: To is a contiguous iterator
+ * over a trivially copyable type that isn't const or volatile and
+ * Value is either that type or both are integers, pointers or bool.
+ */
+template<class To, class Value>
+struct is_bitwise_fillable : false_type
+{
+};
+
+template<class To, class Value>
+    requires(is_contiguous_iterator_v<To>)
+struct is_bitwise_fillable<To, Value>
+    : integral_constant<bool,
+                        is_same_v<iterator_element_t<To>, remove_cv_t<iterator_element_t<To>>> &&
+                            is_trivially_copyable_v<iterator_element_t<To>> &&
+                            (is_same_v<remove_cv_t<Value>, iterator_element_t<To>> ||
+                             (is_bitwise_comparable_v<iterator_element_t<To>> &&
+                              is_bitwise_comparable_v<Value>))>
+{
+};
+
+template<class To, class Value>
+inline constexpr bool is_bitwise_fillable_v = is_bitwise_fillable<To, Value>::value;
+
+/**
+ * True if a value initialized Type is all zero bytes so memory that is
+ * already zero holds value initialized objects: integers, pointers,
+ * bool and (IEEE 754) floating point.  Class types are not included as
+ * they may have member pointers whose null value isn't zero.
+ */
+template<class Type>
+struct is_bitwise_zero_initializable : integral_constant<bool, is_bitwise_comparable_v<Type>>
+{
+};
+
+// clang-format off
+template<> struct is_bitwise_zero_initializable<float> : true_type {};
+template<> struct is_bitwise_zero_initializable<double> : true_type {};
+template<> struct is_bitwise_zero_initializable<long double> : true_type {};
+// clang-format on
+
+template<class Type>
+inline constexpr bool is_bitwise_zero_initializable_v = is_bitwise_zero_initializable<Type>::value;
+
+/**
+ * Copies count objects from source to dest, both contiguous iterators,
+ * with memmove() so the ranges may overlap.
+ */
+template<class OutputIterator, class InputIterator>
+void
+bitwise_copy(OutputIterator dest, InputIterator source, size_t count) noexcept
+{
+    if (count > 0)
+    {
+        auto* const to = pw::to_address(dest);
+        __builtin_memmove(static_cast<void*>(to),
+                          static_cast<void const*>(pw::to_address(source)),
+                          count * sizeof(*to));
+    }
+}
+
+/**
+ * Stores count copies of from, converted to the element type, at the
+ * contiguous iterator dest.
+ *
+ * If every byte of the value is the same (0, -1, any char, ...) this is
+ * a memset().  Otherwise it is a loop of stores of one value the
+ * compiler turns into wide broadcast stores.
+ */
+template<class Iterator, class Value>
+void
+bitwise_fill(Iterator dest, size_t count, Value const& from) noexcept
+{
+    using Type = iterator_element_t<Iterator>;
+
+    Type* const          to      = pw::to_address(dest);
+    Type const           value   = from;
+    unsigned char const* bytes   = reinterpret_cast<unsigned char const*>(&value);
+    bool                 uniform = true;
+    for (size_t index = 1; index < sizeof(Type) && uniform; ++index)
+    {
+        uniform = bytes[index] == bytes[0];
+    }
+    if (uniform)
+    {
+        if (count > 0)
+        {
+            __builtin_memset(static_cast<void*>(to), bytes[0], count * sizeof(Type));
+        }
+        return;
+    }
+    for (size_t index = 0; index < count; ++index)
+    {
+        to[index] = value;
+    }
+}
+
+} // namespace pw::internal
+#endif /* INCLUDED_PW_INTERNAL_BITWISE_COPY_H */
@@ -1,11 +1,29 @@
 #ifndef INCLUDED_PW_INTERNAL_COMPARE_H
 #define INCLUDED_PW_INTERNAL_COMPARE_H
 
+#include <pw/impl/type_traits/is_constant_evaluated.h>
+#include <pw/internal/bitwise_compare.h>
+
 namespace pw::internal {
+
+/**
+ * Three way lexicographical compare using only operator<.  Contiguous
+ * ranges of integers or pointers are compared with memcmp().
+ *
+ * @return -1, 0 or 1
+ */
 template<class Iter1, class Iter2>
-int
+constexpr int
 compare(Iter1 begin1, Iter1 end1, Iter2 begin2, Iter2 end2)
 {
+    if constexpr (is_bitwise_range_v<Iter1, Iter2>)
+    {
+        if (!is_constant_evaluated())
+        {
+            return bitwise_compare(
+                pw::to_address(begin1), end1 - begin1, pw::to_address(begin2), end2 - begin2);
+        }
+    }
     while (begin1 != end1 && begin2 != end2)
     {
         if (*begin1 < *begin2)
@@ -0,0 +1,192 @@
+#ifndef INCLUDED_PW_INTERNAL_INLINE_ALLOCATOR_H
+#define INCLUDED_PW_INTERNAL_INLINE_ALLOCATOR_H
+
+#include <pw/impl/cstddef/size.h>
+#include <pw/impl/memory/allocation_result.h>
+#include <pw/impl/memory/allocator_traits.h>
+#include <pw/impl/type_traits/bool_type.h>
+#include <pw/impl/utility/forward.h>
+#include <pw/impl/vector/construction_policy.h>
+#include <pw/impl/vector/growth_policy.h>
+#include <pw/impl/vector/storage_observer.h>
+#include <pw/internal/allocator_detect.h>
+
+namespace pw::internal {
+
+/**
+ * Uninitialized room for Count elements of Type that lives inside
+ * the container using it.
+ */
+template<class Type, size_t Count>
+struct InlineBuffer
+{
+    constexpr Type* buffer() noexcept { return reinterpret_cast<Type*>(m_bytes); }
+
+    alignas(Type) unsigned char m_bytes[Count * sizeof(Type)];
+    bool m_in_use = false;
+};
+
+/**
+ * An allocator that hands out an InlineBuffer when it is free and
+ * large enough and otherwise forwards to Allocator.
+ *
+ * The buffer belongs to a single container so the allocator never
+ * propagates and two of them are only equal if they share a buffer.
+ * A copy made with select_on_container_copy_construction() has no
+ * buffer and simply forwards to Allocator.
+ */
+template<class Type, size_t Count, class Allocator>
+struct InlineAllocator
+{
+    using value_type                             = Type;
+    using upstream_type                          = Allocator;
+    using size_type                              = allocator_traits<Allocator>::size_type;
+    using difference_type                        = allocator_traits<Allocator>::difference_type;
+    using growth_policy                          = def_or_type<alloc_growth_policy, Allocator, doubling_growth>;
+    using storage_observer = def_or_type<alloc_storage_observer, Allocator, no_storage_observer>;
+    using construction_policy = def_or_type<alloc_construction_policy, Allocator, sequential_construction>;
+    using propagate_on_container_copy_assignment = false_type;
+    using propagate_on_container_move_assignment = false_type;
+    using propagate_on_container_swap            = false_type;
+    using is_always_equal                        = false_type;
+
+    constexpr InlineAllocator(Allocator const& upstream, InlineBuffer<Type, Count>* buffer) noexcept;
+
+    [[nodiscard]] constexpr Type*                               allocate(size_type count);
+    [[nodiscard]] constexpr allocation_result<Type*, size_type> allocate_at_least(size_type count);
+    constexpr void                                              deallocate(Type* ptr, size_type count);
+
+    [[nodiscard]] constexpr Type*   try_expand(Type* ptr, size_type count, size_type new_count);
+    constexpr InlineAllocator       select_on_container_copy_construction() const;
+    constexpr Allocator const&      upstream() const noexcept;
+    [[nodiscard]] constexpr bool    owns(Type const* ptr) const noexcept;
+
+    template<class... Args>
+        requires has_construct_v<Allocator, Type*, Args...>
+    constexpr void construct(Type* ptr, Args&&... args);
+    constexpr void destroy(Type* ptr)
+        requires has_destroy_v<Allocator, Type>;
+
+    friend constexpr bool operator==(InlineAllocator const& op1, InlineAllocator const& op2)
+    {
+        return op1.m_buffer == op2.m_buffer && op1.m_upstream == op2.m_upstream;
+    }
+
+private:
+    Allocator                  m_upstream;
+    InlineBuffer<Type, Count>* m_buffer;
+};
+
+template<class Type, size_t Count, class Allocator>
+constexpr InlineAllocator<Type, Count, Allocator>::InlineAllocator(Allocator const&           upstream,
+                                                                   InlineBuffer<Type, Count>* buffer) noexcept
+    : m_upstream(upstream)
+    , m_buffer(buffer)
+{
+}
+
+/**
+ * Returns the inline buffer if it is free and count fits, otherwise
+ * memory from the upstream allocator.
+ *
+ * @exception std::bad_alloc if the upstream allocation fails
+ */
+template<class Type, size_t Count, class Allocator>
+constexpr Type*
+InlineAllocator<Type, Count, Allocator>::allocate(size_type count)
+{
+    if (m_buffer && !m_buffer->m_in_use && count <= Count)
+    {
+        m_buffer->m_in_use = true;
+        return m_buffer->buffer();
+    }
+    return allocator_traits<Allocator>::allocate(m_upstream, count);
+}
+
+/**
+ * Same as allocate() but reports all Count elements of the inline
+ * buffer and whatever slack the upstream allocator has.
+ */
+template<class Type, size_t Count, class Allocator>
+constexpr allocation_result<Type*, typename InlineAllocator<Type, Count, Allocator>::size_type>
+InlineAllocator<Type, Count, Allocator>::allocate_at_least(size_type count)
+{
+    if (m_buffer && !m_buffer->m_in_use && count <= Count)
+    {
+        m_buffer->m_in_use = true;
+        return { m_buffer->buffer(), Count };
+    }
+    return allocator_traits<Allocator>::allocate_at_least(m_upstream, count);
+}
+
+template<class Type, size_t Count, class Allocator>
+constexpr void
+InlineAllocator<Type, Count, Allocator>::deallocate(Type* ptr, size_type count)
+{
+    if (owns(ptr))
+    {
+        m_buffer->m_in_use = false;
+        return;
+    }
+    allocator_traits<Allocator>::deallocate(m_upstream, ptr, count);
+}
+
+/**
+ * The inline buffer can't grow but upstream memory can if Allocator
+ * supports try_expand().
+ */
+template<class Type, size_t Count, class Allocator>
+constexpr Type*
+InlineAllocator<Type, Count, Allocator>::try_expand(Type* ptr, size_type count, size_type new_count)
+{
+    if (owns(ptr))
+    {
+        return nullptr;
+    }
+    return allocator_traits<Allocator>::try_expand(m_upstream, ptr, count, new_count);
+}
+
+template<class Type, size_t Count, class Allocator>
+constexpr InlineAllocator<Type, Count, Allocator>
+InlineAllocator<Type, Count, Allocator>::select_on_container_copy_construction() const
+{
+    return InlineAllocator(allocator_traits<Allocator>::select_on_container_copy_construction(m_upstream),
+                           nullptr);
+}
+
+template<class Type, size_t Count, class Allocator>
+constexpr Allocator const&
+InlineAllocator<Type, Count, Allocator>::upstream() const noexcept
+{
+    return m_upstream;
+}
+
+/**
+ * @return true if ptr is the start of the inline buffer
+ */
+template<class Type, size_t Count, class Allocator>
+constexpr bool
+InlineAllocator<Type, Count, Allocator>::owns(Type const* ptr) const noexcept
+{
+    return m_buffer && ptr == m_buffer->buffer();
+}
+
+template<class Type, size_t Count, class Allocator>
+template<class... Args>
+    requires has_construct_v<Allocator, Type*, Args...>
+constexpr void
+InlineAllocator<Type, Count, Allocator>::construct(Type* ptr, Args&&... args)
+{
+    m_upstream.construct(ptr, pw::forward<Args>(args)...);
+}
+
+template<class Type, size_t Count, class Allocator>
+constexpr void
+InlineAllocator<Type, Count, Allocator>::destroy(Type* ptr)
+    requires has_destroy_v<Allocator, Type>
+{
+    m_upstream.destroy(ptr);
+}
+
+} // namespace pw::internal
+#endif /* INCLUDED_PW_INTERNAL_INLINE_ALLOCATOR_H */
@@ -0,0 +1,71 @@
+#ifndef INCLUDED_PW_INTERNAL_IS_ITERATOR_H
+#define INCLUDED_PW_INTERNAL_IS_ITERATOR_H
+
+#include <pw/impl/iterator/iterator_tag.h>
+#include <pw/impl/iterator/iterator_traits.h>
+#include <pw/impl/type_traits/is_base_of.h>
+#include <pw/impl/type_traits/remove_reference.h>
+#include <pw/impl/type_traits/void.h>
+#include <pw/impl/utility/declval.h>
+
+namespace pw::internal {
+
+/**
+ * True if Type has an iterator_category (or is a pointer).  Used to
+ * keep `insert(pos, 3, 4)` from picking the iterator overload.
+ */
+template<class Type, class = void>
+inline constexpr bool is_iterator_v = false;
+
+template<class Type>
+inline constexpr bool is_iterator_v<Type, void_t<typename Type::iterator_category>> = true;
+
+template<class Type>
+inline constexpr bool is_iterator_v<Type*> = true;
+
+/**
+ * True if Iterator can be traversed more than once so distance() can
+ * be taken before copying.
+ */
+template<class Iterator>
+inline constexpr bool is_forward_iterator_v =
+    is_base_of<forward_iterator_tag, typename iterator_traits<Iterator>::iterator_category>::value;
+
+/**
+ * True if Iterator supports `iter + n` and `iter2 - iter1` so a range
+ * can be split into pieces.
+ */
+template<class Iterator>
+inline constexpr bool is_random_access_iterator_v =
+    is_base_of<random_access_iterator_tag, typename iterator_traits<Iterator>::iterator_category>::value;
+
+/**
+ * True if Iterator's elements are next to each other in memory so
+ * [begin, end) is the same as [to_address(begin), to_address(end)):
+ * pointers and iterators whose iterator_concept (or, if they have
+ * none, iterator_category) is contiguous_iterator_tag.  std::vector's
+ * and std::string's iterators qualify.
+ *
+ * This is the one trait the bulk memory (memmove(), memset() and
+ * memcmp()) paths check.
+ */
+template<class Iterator, class = void>
+inline constexpr bool is_contiguous_iterator_v =
+    is_base_of<contiguous_iterator_tag, typename iterator_traits<Iterator>::iterator_category>::value;
+
+template<class Iterator>
+inline constexpr bool is_contiguous_iterator_v<Iterator, void_t<typename Iterator::iterator_concept>> =
+    is_base_of<contiguous_iterator_tag, typename Iterator::iterator_concept>::value;
+
+template<class Type>
+inline constexpr bool is_contiguous_iterator_v<Type*> = true;
+
+/**
+ * The type of the elements Iterator refers to keeping const and
+ * volatile, e.g. `int const` for `int const*`.
+ */
+template<class Iterator>
+using iterator_element_t = remove_reference<decltype(*pw::declval<Iterator&>())>::type;
+
+} // namespace pw::internal
+#endif /* INCLUDED_PW_INTERNAL_IS_ITERATOR_H */
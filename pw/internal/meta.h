@@ -43,6 +43,14 @@ struct element_type<Type, void_t<typename Type::element_type>>
     using type = Type::element_type;
 };
 
+/**
+ * element_type<Type> can be formed: Type has an element_type or is
+ * a template whose first argument can stand in for it.
+ */
+template<typename Type>
+inline bool constexpr has_element_type_v =
+    requires { typename Type::element_type; } || requires { typename get_first_arg<Type>::type; };
+
 template<typename Type, typename U>
 struct rebind_first_arg;
 
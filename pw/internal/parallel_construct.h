@@ -0,0 +1,88 @@
+#ifndef INCLUDED_PW_INTERNAL_PARALLEL_CONSTRUCT_H
+#define INCLUDED_PW_INTERNAL_PARALLEL_CONSTRUCT_H
+
+#include <pw/impl/algorithm/min.h>
+#include <pw/impl/cstddef/size.h>
+#include <pw/impl/execution/thread_pool.h>
+
+#include <atomic>
+#include <exception>
+
+namespace pw::internal {
+
+/**
+ * The most pieces parallel_construct() splits a range into.  Enough
+ * for 8 per thread on a 32 core machine.
+ */
+inline constexpr size_t parallel_construct_pieces = 256;
+
+/**
+ * Builds the objects [0, count) in pieces spread across the thread
+ * pool and cleans up if any piece fails.
+ *
+ * construct(first, last) builds [first, last) and, if it throws,
+ * destroys whatever it built before doing so.  Once a piece has thrown
+ * the pieces that haven't started are skipped, destroy(first, last)
+ * is called for each piece that completed and the first exception is
+ * rethrown.  Nothing is left constructed.
+ *
+ * @exception The first exception thrown by construct
+ */
+template<class Construct, class Destroy>
+void
+parallel_construct(size_t count, Construct&& construct, Destroy&& destroy)
+{
+    size_t const pieces = min(min(parallel_construct_pieces, parallel_concurrency() * 8), count);
+    if (pieces <= 1)
+    {
+        construct(size_t(0), count);
+        return;
+    }
+
+    struct Context
+    {
+        size_t             count;
+        size_t             pieces;
+        Construct&         construct;
+        std::atomic<bool>  failed;
+        std::exception_ptr error;
+        bool               done[parallel_construct_pieces];
+
+        size_t first(size_t piece) const noexcept { return count * piece / pieces; }
+    } context { count, pieces, construct, false, nullptr, {} };
+
+    ParallelTask task = [](void* data, size_t begin, size_t end) noexcept {
+        Context& context = *static_cast<Context*>(data);
+        for (size_t piece = begin; piece < end && !context.failed.load(std::memory_order_relaxed); ++piece)
+        {
+            try
+            {
+                context.construct(context.first(piece), context.first(piece + 1));
+                context.done[piece] = true;
+            }
+            catch (...)
+            {
+                if (!context.failed.exchange(true))
+                {
+                    context.error = std::current_exception();
+                }
+            }
+        }
+    };
+    parallel_run(pieces, 1, task, &context);
+
+    if (context.failed.load())
+    {
+        for (size_t piece = 0; piece < pieces; ++piece)
+        {
+            if (context.done[piece])
+            {
+                destroy(context.first(piece), context.first(piece + 1));
+            }
+        }
+        std::rethrow_exception(context.error);
+    }
+}
+
+} // namespace pw::internal
+#endif /* INCLUDED_PW_INTERNAL_PARALLEL_CONSTRUCT_H */
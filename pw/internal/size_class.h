@@ -0,0 +1,107 @@
+#ifndef INCLUDED_PW_INTERNAL_SIZE_CLASS_H
+#define INCLUDED_PW_INTERNAL_SIZE_CLASS_H
+
+#include <pw/impl/cstddef/size.h>
+
+namespace pw::internal {
+
+/**
+ * Rounds a request up to the block size a malloc() implementation
+ * would hand out anyway.
+ *
+ * This follows jemalloc's size classes: multiples of 16 bytes up to
+ * 128 bytes and then four classes for every power of two (160, 192,
+ * 224, 256, 320, ...).  The classes keep growing by 25% with no upper
+ * limit so use allocation_size() to size a single large block.
+ *
+ * @param bytes The number of bytes requested
+ * @return The size class holding bytes (0 for 0)
+ */
+constexpr size_t
+size_class(size_t bytes) noexcept
+{
+    constexpr size_t quantum = 16;
+
+    if (bytes <= 8 * quantum)
+    {
+        return (bytes + quantum - 1) & ~(quantum - 1);
+    }
+    size_t const power   = size_t { 1 } << (8 * sizeof(size_t) - 1 - __builtin_clzll(bytes - 1));
+    size_t const spacing = power / 4;
+    size_t const rounded = (bytes + spacing - 1) & ~(spacing - 1);
+
+    return rounded < bytes ? bytes : rounded;
+}
+
+/**
+ * Rounds a request for a single block up to what malloc() is likely
+ * to hand out.
+ *
+ * Below the mmap() threshold this is size_class().  glibc's bins are
+ * finer so some of the rounding can be memory it wouldn't have used,
+ * but it is never more than a quarter of a small block.  Larger blocks
+ * are mapped a page at a time so they are only rounded up to a whole
+ * page rather than to a size class that may be 25% bigger.
+ *
+ * @param bytes The number of bytes requested
+ * @return The number of bytes to ask for (0 for 0)
+ */
+constexpr size_t
+allocation_size(size_t bytes) noexcept
+{
+    constexpr size_t mmap_threshold = 128 * 1024;
+    constexpr size_t page_size      = 4096;
+
+    if (bytes <= mmap_threshold)
+    {
+        return size_class(bytes);
+    }
+    size_t const rounded = (bytes + page_size - 1) & ~(page_size - 1);
+
+    return rounded < bytes ? bytes : rounded;
+}
+
+/**
+ * Numbers the size classes 0, 1, 2, ... so they can index an array:
+ * 16 is 0, 32 is 1, ..., 128 is 7, 160 is 8, 192 is 9 and so on.
+ *
+ * @param bytes The number of bytes requested; must be at least 1
+ * @return The index of size_class(bytes)
+ */
+constexpr size_t
+size_class_index(size_t bytes) noexcept
+{
+    constexpr size_t quantum = 16;
+
+    size_t const rounded = size_class(bytes);
+    if (rounded <= 8 * quantum)
+    {
+        return rounded / quantum - 1;
+    }
+    size_t const log2    = 8 * sizeof(size_t) - 1 - __builtin_clzll(rounded - 1);
+    size_t const spacing = (size_t { 1 } << log2) / 4;
+
+    return 8 + (log2 - 7) * 4 + ((rounded - (size_t { 1 } << log2)) / spacing - 1);
+}
+
+/**
+ * The inverse of size_class_index()
+ *
+ * @param index A size class index
+ * @return The number of bytes in that size class
+ */
+constexpr size_t
+size_class_bytes(size_t index) noexcept
+{
+    constexpr size_t quantum = 16;
+
+    if (index < 8)
+    {
+        return (index + 1) * quantum;
+    }
+    size_t const power = size_t { 8 * quantum } << ((index - 8) / 4);
+    return power + ((index - 8) % 4 + 1) * (power / 4);
+}
+
+} // namespace pw::internal
+#endif /* INCLUDED_PW_INTERNAL_SIZE_CLASS_H */
@@ -1,14 +1,34 @@
 #ifndef INCLUDED_PW_INTERNAL_STORAGE_H
 #define INCLUDED_PW_INTERNAL_STORAGE_H
 
+#include <pw/impl/algorithm/copy.h>
 #include <pw/impl/algorithm/max.h>
+#include <pw/impl/algorithm/move.h>
+#include <pw/impl/algorithm/move_backward.h>
 #include <pw/impl/allocator/allocator.h>
 #include <pw/impl/memory/addressof.h>
 #include <pw/impl/memory/allocator_traits.h>
-#include <pw/impl/memory/destroy.h>
+#include <pw/impl/memory/pointer_traits.h>
 #include <pw/impl/memory/uninitialized_construct_using_allocator.h>
+#include <pw/impl/type_traits/bool_type.h>
+#include <pw/impl/type_traits/is_constant_evaluated.h>
+#include <pw/impl/type_traits/is_constructible.h>
+#include <pw/impl/type_traits/is_move_constructible.h>
+#include <pw/impl/type_traits/is_same.h>
+#include <pw/impl/type_traits/is_trivially_copyable.h>
+#include <pw/impl/type_traits/is_trivially_default_constructible.h>
+#include <pw/impl/type_traits/is_trivially_destructible.h>
+#include <pw/impl/type_traits/is_trivially_relocatable.h>
+#include <pw/impl/utility/exchange.h>
 #include <pw/impl/utility/move.h>
 #include <pw/impl/utility/swap.h>
+#include <pw/impl/vector/construction_policy.h>
+#include <pw/impl/vector/growth_policy.h>
+#include <pw/impl/vector/storage_observer.h>
+#include <pw/internal/allocator_detect.h>
+#include <pw/internal/bitwise_copy.h>
+#include <pw/internal/is_iterator.h>
+#include <pw/internal/parallel_construct.h>
 
 namespace pw::internal {
 
@@ -40,6 +60,53 @@ struct Storage
     using const_pointer                = allocator_traits<Allocator>::const_pointer;
     using iterator                     = pointer;
     using const_iterator               = const_pointer;
+    using growth_policy                = def_or_type<alloc_growth_policy, Allocator, doubling_growth>;
+    using observer                     = def_or_type<alloc_storage_observer, Allocator, no_storage_observer>;
+    using construction_policy =
+        def_or_type<alloc_construction_policy, Allocator, sequential_construction>;
+
+    /**
+     * Elements can be relocated with memmove().  This requires Type to be
+     * trivially relocatable and, unless the bytes are the whole story (it is
+     * trivially copyable), an Allocator that does not customize construct().
+     */
+    static constexpr bool trivially_relocatable =
+        is_trivially_relocatable_v<value_type> &&
+        (is_trivially_copyable_v<value_type> || !has_construct_v<allocator_type, pointer, value_type&&>);
+
+    /**
+     * Copy or move constructing an element is the same as copying its
+     * bytes: Type is trivially copyable and Allocator does not customize
+     * construct().  Bulk construction then becomes memmove()/memset().
+     */
+    static constexpr bool bitwise_construct = is_trivially_copyable_v<value_type> &&
+                                              !has_construct_v<allocator_type, pointer, value_type const&> &&
+                                              !has_construct_v<allocator_type, pointer, value_type&&>;
+
+    /**
+     * Value initialized elements can be had by allocating memory that is
+     * already zero: Allocator has allocate_zeroed(), a value initialized
+     * Type is all zero bytes and Allocator does not customize construct().
+     */
+    static constexpr bool zero_allocate = has_allocate_zeroed_v<allocator_type> &&
+                                          is_bitwise_zero_initializable_v<value_type> &&
+                                          !has_construct_v<allocator_type, pointer>;
+
+    /**
+     * Growing moves the elements to the new memory instead of copying
+     * them.  As with std::move_if_noexcept() that is when moving can't
+     * throw (so the strong exception guarantee holds) or Type can't be
+     * copied anyway.
+     */
+    static constexpr bool move_on_reallocate = trivially_relocatable ||
+                                               is_nothrow_move_constructible_v<value_type> ||
+                                               !is_copy_constructible_v<value_type>;
+
+    /**
+     * Allocator frees its memory all at once (e.g. arena_allocator) and
+     * its deallocate() does nothing so there is no need to call it.
+     */
+    static constexpr bool bulk_release = def_or_type<alloc_bulk_release, Allocator, false_type>::value;
 
     Storage()                          = delete; // Require allocator to be provided
     Storage(Storage const&)            = delete; // Not intended to be copied
@@ -47,7 +114,7 @@ struct Storage
     Storage& operator=(Storage const&) = delete;
     Storage& operator=(Storage&&)      = delete;
     constexpr explicit Storage(allocator_type const& alloc);
-    constexpr Storage(allocator_type const& alloc, size_type count);
+    constexpr Storage(allocator_type const& alloc, size_type count, bool at_least = true);
     constexpr ~Storage();
 
     [[nodiscard]] constexpr bool      empty() const noexcept;
@@ -65,15 +132,24 @@ struct Storage
     constexpr allocator_type&         allocator() noexcept;
     constexpr allocator_type          copy_allocator() const;
     constexpr void                    swap_allocator(Storage& other);
+    constexpr void                    take_buffer(Storage& other) noexcept;
+    constexpr void                    replace_with(Storage& other) noexcept;
     constexpr void                    destroy(iterator begin, iterator end);
     constexpr Storage&                reset_to(size_type count);
+    constexpr Storage&                reset_to_value_initialized(size_type count);
+    constexpr bool                    try_expand(size_type count, const_pointer keep = nullptr);
     constexpr iterator                copy(const_iterator begin, const_iterator end, iterator dest);
     constexpr iterator                move(iterator begin, iterator end, iterator dest);
     constexpr iterator                move_backward(iterator begin, iterator end, iterator dest);
     constexpr iterator                fill_n(iterator dest, size_type count, value_type const& value);
     constexpr Storage&                uninitialized_fill(iterator begin, iterator end, value_type const& val);
     constexpr Storage&                uninitialized_default_construct(iterator begin, iterator end);
+    constexpr Storage&                uninitialized_default_init(iterator begin, iterator end);
     constexpr Storage&                uninitialized_move(iterator begin, iterator end, iterator dest);
+    constexpr Storage&                relocate(iterator begin, iterator end, iterator dest);
+    constexpr Storage&                relocate(Storage& other, size_type offset = 0, size_type count = 0);
+    constexpr Storage&
+    transfer_from(Storage& other, size_type offset = 0, size_type count = 0);
     constexpr void
     swap(Storage& other) noexcept(allocator_traits<allocator_type>::propagate_on_container_swap::value ||
                                   allocator_traits<allocator_type>::is_always_equal::value);
@@ -83,6 +159,12 @@ struct Storage
     constexpr Storage& uninitialized_copy(InputIterator begin, InputIterator end, iterator dest);
 
 private:
+    template<class Construct>
+    constexpr void construct_pieces(iterator dest, size_type count, Construct construct);
+    constexpr void free_buffer() noexcept;
+    static constexpr void
+    record(storage_event::kind what, size_type count, size_type old_capacity, size_type new_capacity) noexcept;
+
     allocator_type m_alloc;
     pointer        m_begin;
     size_type      m_size;
@@ -100,20 +182,40 @@ constexpr Storage<Type, Allocator>::Storage(allocator_type const& alloc)
 {
 }
 
+/**
+ * Allocates memory for count elements.
+ *
+ * By default this uses `allocator_traits::allocate_at_least()` so
+ * capacity() includes any slack the allocator hands back.
+ *
+ * @param alloc The allocator to copy
+ * @param count The number of elements to allocate
+ * @param at_least false to allocate exactly count elements
+ */
 template<class Type, class Allocator>
-constexpr Storage<Type, Allocator>::Storage(allocator_type const& alloc, size_type count)
+constexpr Storage<Type, Allocator>::Storage(allocator_type const& alloc, size_type count, bool at_least)
     : m_alloc(alloc)
-    , m_begin(count > 0 ? allocator_traits<Allocator>::allocate(m_alloc, count) : nullptr)
+    , m_begin(nullptr)
     , m_size(0)
-    , m_allocated(count)
+    , m_allocated(0)
 {
+    if (count > 0 && at_least)
+    {
+        auto const result = allocator_traits<Allocator>::allocate_at_least(m_alloc, count);
+        m_begin           = result.ptr;
+        m_allocated       = result.count;
+    }
+    else if (count > 0)
+    {
+        m_begin     = allocator_traits<Allocator>::allocate(m_alloc, count);
+        m_allocated = count;
+    }
 }
 
 template<class Type, class Allocator>
 constexpr Storage<Type, Allocator>::~Storage()
 {
-    pw::destroy(m_begin, m_begin + m_size);
-    allocator_traits<Allocator>::deallocate(m_alloc, m_begin, m_allocated);
+    free_buffer();
 }
 
 template<class Type, class Allocator>
@@ -181,7 +283,7 @@ Storage<Type, Allocator>::size() const noexcept
 }
 
 /**
- * Doubles the existing value for capacity()
+ * Asks growth_policy for the capacity() to grow to.
  *
  * @return The next size to allocate (always >= 1).
  */
@@ -189,7 +291,8 @@ template<class Type, class Allocator>
 constexpr Storage<Type, Allocator>::size_type
 Storage<Type, Allocator>::calc_size() const noexcept
 {
-    return max(static_cast<size_type>(1), 2 * m_allocated);
+    return max(static_cast<size_type>(1),
+               static_cast<size_type>(growth_policy::next_capacity(m_allocated, sizeof(value_type))));
 }
 
 template<class Type, class Allocator>
@@ -226,6 +329,42 @@ Storage<Type, Allocator>::swap_allocator(Storage& other)
     pw::swap(m_alloc, other.m_alloc);
 }
 
+/**
+ * Destroys this Storage's elements and frees its memory and then takes
+ * over other's memory, leaving other empty.  Nothing is allocated or
+ * moved so the allocators must compare equal.
+ *
+ * @param other The Storage to take the memory from
+ */
+template<class Type, class Allocator>
+constexpr void
+Storage<Type, Allocator>::take_buffer(Storage& other) noexcept
+{
+    free_buffer();
+    m_begin     = pw::exchange(other.m_begin, nullptr);
+    m_size      = pw::exchange(other.m_size, 0);
+    m_allocated = pw::exchange(other.m_allocated, 0);
+}
+
+/**
+ * Swaps in other's memory after a reallocation, e.g. once the elements
+ * have been relocated into other, and reports it to the observer.
+ *
+ * @param other The new memory; ends up holding the old memory
+ */
+template<class Type, class Allocator>
+constexpr void
+Storage<Type, Allocator>::replace_with(Storage& other) noexcept
+{
+    record(other.m_allocated < m_allocated ? storage_event::kind::shrink : storage_event::kind::reallocate,
+           0,
+           m_allocated,
+           other.m_allocated);
+    pw::swap(m_begin, other.m_begin);
+    pw::swap(m_size, other.m_size);
+    pw::swap(m_allocated, other.m_allocated);
+}
+
 template<class Type, class Allocator>
 constexpr void
 Storage<Type, Allocator>::swap(Storage& other)
@@ -256,14 +395,21 @@ Storage<Type, Allocator>::construct(iterator where, Args&&... args)
     pw::uninitialized_construct_using_allocator(pw::addressof(*where), m_alloc, pw::forward<Args>(args)...);
 }
 
+/**
+ * Destroys the objects in [begin, end).  This is a no-op for trivially
+ * destructible types unless Allocator has its own destroy().
+ */
 template<class Type, class Allocator>
 constexpr void
 Storage<Type, Allocator>::destroy(iterator begin, iterator end)
 {
-    while (begin != end)
+    if constexpr (!is_trivially_destructible_v<value_type> || has_destroy_v<allocator_type, value_type>)
     {
-        allocator_traits<Allocator>::destroy(m_alloc, pw::addressof(*begin));
-        ++begin;
+        while (begin != end)
+        {
+            allocator_traits<Allocator>::destroy(m_alloc, pw::addressof(*begin));
+            ++begin;
+        }
     }
 }
 
@@ -274,7 +420,7 @@ Storage<Type, Allocator>::destroy(iterator begin, iterator end)
  * are destroyed.
  *
  * @param count The number of elements to reserve space for.  0 sets
- *              m_begin to nullptr
+ *              m_begin to nullptr.  The allocator may provide more.
  * @return Reference to this storage
  * @exception std::bad_alloc if memory allocation fails
  */
@@ -282,62 +428,124 @@ template<class Type, class Allocator>
 constexpr Storage<Type, Allocator>&
 Storage<Type, Allocator>::reset_to(size_type count)
 {
-    pointer p;
+    pointer p = nullptr;
     if (count > 0)
     {
-        p = allocator_traits<Allocator>::allocate(m_alloc, count);
-    }
-    else
-    {
-        p = nullptr;
-    }
-    if (m_begin)
-    {
-        destroy(begin(), end());
-        allocator_traits<Allocator>::deallocate(m_alloc, begin(), m_allocated);
+        auto const result = allocator_traits<Allocator>::allocate_at_least(m_alloc, count);
+        p                 = result.ptr;
+        count             = result.count;
     }
+    free_buffer();
     m_begin     = p;
     m_size      = 0;
     m_allocated = count;
     return *this;
 }
 
+/**
+ * Replaces the contents with count value initialized elements.
+ *
+ * With zero_allocate the memory comes from `allocate_zeroed()` and
+ * nothing is written: the OS supplies zero pages lazily so a huge
+ * Storage costs nothing until it is touched.  Otherwise (and during
+ * constant evaluation) it is reset_to() and then
+ * uninitialized_default_construct().
+ *
+ * @param count The number of elements
+ * @return Reference to this storage with size() == count
+ * @exception std::bad_alloc if memory allocation fails or anything
+ *            thrown by Type's default constructor
+ */
+template<class Type, class Allocator>
+constexpr Storage<Type, Allocator>&
+Storage<Type, Allocator>::reset_to_value_initialized(size_type count)
+{
+    if constexpr (zero_allocate)
+    {
+        if (!is_constant_evaluated() && count > 0)
+        {
+            auto const result = allocator_traits<Allocator>::allocate_zeroed(m_alloc, count);
+            if (result.ptr)
+            {
+                free_buffer();
+                m_begin     = result.ptr;
+                m_size      = count;
+                m_allocated = result.count;
+                return *this;
+            }
+        }
+    }
+    reset_to(count);
+    return uninitialized_default_construct(begin(), begin() + count).set_size(count);
+}
+
+/**
+ * Tries to grow capacity() to count without allocating a new Storage.
+ *
+ * This uses `allocator_traits::try_expand()` and only applies when
+ * the elements are trivially relocatable since the allocator may move
+ * them.  Iterators and references are invalidated if it succeeds.
+ * Growth is reported to the observer like any other reallocation,
+ * with a relocate event when the allocator moved the elements.
+ *
+ * @param count The new capacity
+ * @param keep An object that must stay valid, e.g. the argument to
+ *             push_back().  Nothing is done if it is one of the elements.
+ * @return true if capacity() is now count
+ */
+template<class Type, class Allocator>
+constexpr bool
+Storage<Type, Allocator>::try_expand(size_type count, const_pointer keep)
+{
+    if constexpr (trivially_relocatable && has_try_expand_v<allocator_type>)
+    {
+        if (!is_constant_evaluated() && m_begin != nullptr &&
+            (keep == nullptr || keep < m_begin || keep >= m_begin + m_size))
+        {
+            pointer p = allocator_traits<Allocator>::try_expand(m_alloc, m_begin, m_allocated, count);
+            if (p != nullptr)
+            {
+                if (p != m_begin)
+                {
+                    record(storage_event::kind::relocate, m_size, 0, 0);
+                }
+                record(storage_event::kind::reallocate, 0, m_allocated, count);
+                m_begin     = p;
+                m_allocated = count;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 template<class Type, class Allocator>
 constexpr Storage<Type, Allocator>::iterator
 // ReSharper disable once CppMemberFunctionMayBeStatic
 Storage<Type, Allocator>::copy(const_iterator begin, const_iterator end, iterator dest)
 {
-    while (begin != end)
-    {
-        *dest = *begin;
-        ++dest;
-        ++begin;
-    }
-    return dest;
+    return pw::copy(begin, end, dest);
 }
 
 template<class Type, class Allocator>
 constexpr Storage<Type, Allocator>::iterator
 Storage<Type, Allocator>::move(iterator begin, iterator end, iterator dest)
 {
-    while (begin != end)
-    {
-        *dest++ = pw::move(*begin++);
-    }
-    return dest;
+    return pw::move(begin, end, dest);
 }
 
+/**
+ * Move assigns [begin, end) to the live objects ending at dest,
+ * starting with the last one so the ranges may overlap.
+ *
+ * @return The start of the destination range
+ */
 template<class Type, class Allocator>
 constexpr Storage<Type, Allocator>::iterator
+// ReSharper disable once CppMemberFunctionMayBeStatic
 Storage<Type, Allocator>::move_backward(iterator begin, iterator end, iterator dest)
 {
-    while (begin != end)
-    {
-        --dest;
-        --end;
-        construct(dest, pw::move(*end));
-    }
-    return dest;
+    return pw::move_backward(begin, end, dest);
 }
 
 template<class Type, class Allocator>
@@ -366,71 +574,414 @@ template<class Type, class Allocator>
 constexpr Storage<Type, Allocator>&
 Storage<Type, Allocator>::uninitialized_fill(iterator begin, iterator end, value_type const& val)
 {
-    iterator current = begin;
-    try
+    if constexpr (bitwise_construct)
     {
-        while (current != end)
+        if (!is_constant_evaluated())
         {
-            construct(current, val);
-            ++current;
+            auto const fill_piece = [&val](iterator first, iterator last) {
+                bitwise_fill(pw::to_address(first), static_cast<size_type>(last - first), val);
+            };
+            construct_pieces(begin, static_cast<size_type>(end - begin), fill_piece);
+            return *this;
         }
     }
-    catch (...)
+    construct_pieces(begin, static_cast<size_type>(end - begin), [this, &val](iterator first, iterator last) {
+        iterator current = first;
+        try
+        {
+            while (current != last)
+            {
+                construct(current, val);
+                ++current;
+            }
+        }
+        catch (...)
+        {
+            destroy(first, current);
+            throw;
+        }
+    });
+    return *this;
+}
+
+template<class Type, class Allocator>
+constexpr Storage<Type, Allocator>&
+Storage<Type, Allocator>::uninitialized_default_construct(iterator begin, iterator end)
+{
+    if constexpr (is_trivially_default_constructible_v<value_type> && is_trivially_copyable_v<value_type> &&
+                  !has_construct_v<allocator_type, pointer>)
     {
-        destroy(begin, current);
-        throw;
+        if (!is_constant_evaluated())
+        {
+            // Stores copies of a value initialized Type: memset(0) for
+            // arithmetic types and structs of them
+            value_type const zero       = value_type();
+            auto const       fill_piece = [&zero](iterator first, iterator last) {
+                bitwise_fill(pw::to_address(first), static_cast<size_type>(last - first), zero);
+            };
+            construct_pieces(begin, static_cast<size_type>(end - begin), fill_piece);
+            return *this;
+        }
     }
+    construct_pieces(begin, static_cast<size_type>(end - begin), [this](iterator first, iterator last) {
+        iterator current = first;
+        try
+        {
+            while (current != last)
+            {
+                construct(current);
+                ++current;
+            }
+        }
+        catch (...)
+        {
+            destroy(first, current);
+            throw;
+        }
+    });
     return *this;
 }
 
+/**
+ * Starts the lifetime of the objects in [begin, end) without giving
+ * them a value when that is allowed.
+ *
+ * A trivially default constructible Type whose allocator has no
+ * construct() is left as whatever bytes are in memory, so this does
+ * no work at all.  Otherwise (and during constant evaluation) it is
+ * the same as uninitialized_default_construct().
+ *
+ * @return Reference to this storage
+ * @exception Anything thrown by Type's default constructor
+ */
 template<class Type, class Allocator>
 constexpr Storage<Type, Allocator>&
-Storage<Type, Allocator>::uninitialized_default_construct(iterator begin, iterator end)
+Storage<Type, Allocator>::uninitialized_default_init(iterator begin, iterator end)
 {
-    iterator current = begin;
-    try
+    if constexpr (is_trivially_default_constructible_v<value_type> && !has_construct_v<allocator_type, pointer>)
     {
-        while (current != end)
+        if (!is_constant_evaluated())
         {
-            construct(current);
-            ++current;
+            return *this;
         }
     }
-    catch (...)
+    return uninitialized_default_construct(begin, end);
+}
+
+template<class Type, class Allocator>
+constexpr Storage<Type, Allocator>&
+Storage<Type, Allocator>::uninitialized_move(iterator begin, iterator end, iterator dest)
+{
+    if constexpr (bitwise_construct)
     {
-        destroy(begin, current);
-        throw;
+        if (!is_constant_evaluated())
+        {
+            auto const copy_piece = [begin, dest](iterator first, iterator last) {
+                bitwise_copy(pw::to_address(first), pw::to_address(begin + (first - dest)),
+                             static_cast<size_type>(last - first));
+            };
+            construct_pieces(dest, static_cast<size_type>(end - begin), copy_piece);
+            return *this;
+        }
     }
+    auto const move_piece = [this, begin, dest](iterator first, iterator last) {
+        iterator source  = begin + (first - dest);
+        iterator current = first;
+        try
+        {
+            while (current != last)
+            {
+                construct(current, pw::move(*source));
+                ++current;
+                ++source;
+            }
+        }
+        catch (...)
+        {
+            destroy(first, current);
+            throw;
+        }
+    };
+    construct_pieces(dest, static_cast<size_type>(end - begin), move_piece);
     return *this;
 }
 
+/**
+ * Relocates the objects in [begin, end) to the uninitialized memory at dest.
+ *
+ * Afterwards [begin, end) no longer holds any objects; the caller is
+ * responsible for the size() that counted them.  When Type is trivially
+ * relocatable this is a single memmove() with no destructor calls (and
+ * the ranges may overlap).  Otherwise each object is move constructed
+ * and then the originals are destroyed.
+ *
+ * @param begin First object to relocate
+ * @param end One past the last object to relocate
+ * @param dest Start of the uninitialized destination
+ * @return Reference to this storage
+ * @exception Any exception thrown by Type's move constructor.  The objects
+ *            already constructed at dest are destroyed and [begin, end) is
+ *            left in place.
+ */
 template<class Type, class Allocator>
 constexpr Storage<Type, Allocator>&
-Storage<Type, Allocator>::uninitialized_move(iterator begin, iterator end, iterator dest)
+Storage<Type, Allocator>::relocate(iterator begin, iterator end, iterator dest)
 {
-    iterator current = dest;
-    try
+    if constexpr (trivially_relocatable)
     {
-        while (begin != end)
+        if (!is_constant_evaluated())
         {
-            construct(current, pw::move(*begin));
-            ++current;
-            ++begin;
+            if (begin != end)
+            {
+                __builtin_memmove(static_cast<void*>(pw::to_address(dest)),
+                                  static_cast<void const*>(pw::to_address(begin)),
+                                  static_cast<size_type>(end - begin) * sizeof(value_type));
+            }
+            return *this;
         }
     }
-    catch (...)
+    uninitialized_move(begin, end, dest);
+    destroy(begin, end);
+    return *this;
+}
+
+/**
+ * Relocates every element of other into this Storage leaving a gap of
+ * count elements at offset.
+ *
+ * This is how a container grows: allocate a new Storage, construct the
+ * new elements in the gap and then relocate the existing ones around them.
+ * The elements in the gap must already be constructed and this Storage must
+ * otherwise be empty.  On return size() is other.size() + count and other
+ * is empty but still owns its memory.
+ *
+ * @param other The Storage holding the existing elements
+ * @param offset Index in other of the first element placed after the gap
+ * @param count The number of constructed elements at begin() + offset
+ * @return Reference to this storage
+ * @exception Any exception thrown by Type's move constructor.  The gap and
+ *            any relocated elements are destroyed and other is unchanged.
+ */
+template<class Type, class Allocator>
+constexpr Storage<Type, Allocator>&
+Storage<Type, Allocator>::relocate(Storage& other, size_type offset, size_type count)
+{
+    iterator const gap  = begin() + offset;
+    iterator const tail = gap + count;
+
+    if (trivially_relocatable && !is_constant_evaluated())
     {
-        destroy(dest, current);
-        throw;
+        // The buffers are distinct so large ones can be copied in pieces
+        iterator const source      = other.begin();
+        auto const     relocate_to = [this, source](iterator start, size_type from, size_type count) {
+            construct_pieces(start, count, [this, source, start, from](iterator first, iterator last) {
+                relocate(source + from + (first - start), source + from + (last - start), first);
+            });
+        };
+        relocate_to(begin(), 0, offset);
+        relocate_to(tail, offset, other.m_size - offset);
+        record(storage_event::kind::relocate, other.m_size, 0, 0);
+    }
+    else
+    {
+        try
+        {
+            uninitialized_move(other.begin() + offset, other.end(), tail);
+        }
+        catch (...)
+        {
+            destroy(gap, tail);
+            throw;
+        }
+        try
+        {
+            uninitialized_move(other.begin(), other.begin() + offset, begin());
+        }
+        catch (...)
+        {
+            destroy(gap, tail + (other.size() - offset));
+            throw;
+        }
+        other.destroy(other.begin(), other.end());
+        record(storage_event::kind::move, other.m_size, 0, 0);
     }
+    m_size       = other.m_size + count;
+    other.m_size = 0;
     return *this;
 }
 
+/**
+ * Fills this new Storage with other's elements, leaving a gap of count
+ * already constructed elements at offset, the way a container grows.
+ *
+ * When move_on_reallocate is true this is relocate(other, offset,
+ * count).  Otherwise the elements are copied: other is left unchanged
+ * (still holding its elements) so nothing is lost if a copy
+ * constructor throws, which gives the strong exception guarantee.
+ *
+ * @param other The Storage holding the existing elements
+ * @param offset Index in other of the first element placed after the gap
+ * @param count The number of constructed elements at begin() + offset
+ * @return Reference to this storage with size() == other.size() + count
+ * @exception Anything thrown by Type's move or copy constructor.  The
+ *            gap and the elements moved or copied so far are destroyed.
+ */
+template<class Type, class Allocator>
+constexpr Storage<Type, Allocator>&
+Storage<Type, Allocator>::transfer_from(Storage& other, size_type offset, size_type count)
+{
+    if constexpr (move_on_reallocate)
+    {
+        return relocate(other, offset, count);
+    }
+    else
+    {
+        iterator const gap  = begin() + offset;
+        iterator const tail = gap + count;
+        try
+        {
+            uninitialized_copy(other.begin() + offset, other.end(), tail);
+        }
+        catch (...)
+        {
+            destroy(gap, tail);
+            throw;
+        }
+        try
+        {
+            uninitialized_copy(other.begin(), other.begin() + offset, begin());
+        }
+        catch (...)
+        {
+            destroy(gap, tail + (other.size() - offset));
+            throw;
+        }
+        m_size = other.m_size + count;
+        record(storage_event::kind::copy, other.m_size, 0, 0);
+        return *this;
+    }
+}
+
+/**
+ * Calls construct(first, last) to build the count objects at dest.
+ *
+ * When construction_policy allows it and there are enough bytes the
+ * range is split into pieces built across the thread pool; otherwise
+ * (and during constant evaluation) it is a single call.  construct
+ * must destroy what it built before letting an exception escape.  If
+ * a piece fails the completed pieces are destroyed and the exception
+ * rethrown.
+ */
+template<class Type, class Allocator>
+template<class Construct>
+constexpr void
+Storage<Type, Allocator>::construct_pieces(iterator dest, size_type count, Construct construct)
+{
+    if constexpr (construction_policy::parallel_bytes != static_cast<size_t>(-1))
+    {
+        if (!is_constant_evaluated() && count * sizeof(value_type) >= construction_policy::parallel_bytes)
+        {
+            parallel_construct(
+                count,
+                [dest, &construct](size_t first, size_t last) { construct(dest + first, dest + last); },
+                [this, dest](size_t first, size_t last) { destroy(dest + first, dest + last); });
+            return;
+        }
+    }
+    construct(dest, dest + count);
+}
+
+/**
+ * Destroys the elements and gives the memory back to the allocator.
+ * With a bulk_release allocator and trivially destructible elements
+ * this compiles to nothing.  m_begin is left dangling for the caller
+ * to replace.
+ */
+template<class Type, class Allocator>
+constexpr void
+Storage<Type, Allocator>::free_buffer() noexcept
+{
+    if (m_begin)
+    {
+        destroy(begin(), end());
+        if constexpr (!bulk_release)
+        {
+            allocator_traits<Allocator>::deallocate(m_alloc, m_begin, m_allocated);
+        }
+    }
+}
+
+/**
+ * Passes an event to the observer.  Compiles to nothing with the
+ * default no_storage_observer.  Moving, copying or relocating no
+ * elements isn't worth reporting.
+ */
+template<class Type, class Allocator>
+constexpr void
+Storage<Type, Allocator>::record(storage_event::kind what,
+                                 size_type           count,
+                                 size_type           old_capacity,
+                                 size_type           new_capacity) noexcept
+{
+    if constexpr (!is_same_v<observer, no_storage_observer>)
+    {
+        if (!is_constant_evaluated() && (count > 0 || old_capacity != new_capacity))
+        {
+            observer::record(storage_event { what, sizeof(value_type), count, old_capacity, new_capacity });
+        }
+    }
+}
+
+/**
+ * Copy constructs [begin, end) into the uninitialized memory at dest.
+ * A random access range may be copied in parallel (see
+ * construction_policy) and a pointer range of a bitwise_construct Type
+ * is copied with memmove().
+ *
+ * @return Reference to this storage
+ * @exception Anything thrown by Type's copy constructor.  The copies
+ *            made so far are destroyed.
+ */
 template<class Type, class Allocator>
 template<class InputIterator>
 constexpr Storage<Type, Allocator>&
 Storage<Type, Allocator>::uninitialized_copy(InputIterator begin, InputIterator end, iterator dest)
 {
+    if constexpr (bitwise_construct && is_bitwise_copyable_range_v<InputIterator, value_type*>)
+    {
+        if (!is_constant_evaluated())
+        {
+            auto const copy_piece = [begin, dest](iterator first, iterator last) {
+                bitwise_copy(
+                    pw::to_address(first), begin + (first - dest), static_cast<size_type>(last - first));
+            };
+            construct_pieces(dest, static_cast<size_type>(end - begin), copy_piece);
+            return *this;
+        }
+    }
+    if constexpr (is_random_access_iterator_v<InputIterator>)
+    {
+        auto const copy_piece = [this, begin, dest](iterator first, iterator last) {
+            InputIterator source  = begin + (first - dest);
+            iterator      current = first;
+            try
+            {
+                while (current != last)
+                {
+                    construct(current, *source);
+                    ++current;
+                    ++source;
+                }
+            }
+            catch (...)
+            {
+                destroy(first, current);
+                throw;
+            }
+        };
+        construct_pieces(dest, static_cast<size_type>(end - begin), copy_piece);
+        return *this;
+    }
     iterator current = dest;
     try
     {
@@ -0,0 +1,51 @@
+#ifndef INCLUDED_PW_INTERNAL_TEMPORARY_VALUE_H
+#define INCLUDED_PW_INTERNAL_TEMPORARY_VALUE_H
+
+#include <pw/impl/memory/allocator_traits.h>
+#include <pw/impl/memory/uninitialized_construct_using_allocator.h>
+#include <pw/impl/utility/forward.h>
+
+namespace pw::internal {
+
+/**
+ * A Type constructed and destroyed with Allocator but not part of any
+ * container.
+ *
+ * emplace() builds the new element here before shifting the others
+ * since its arguments may refer to elements that are about to move.
+ */
+template<class Type, class Allocator>
+struct TemporaryValue
+{
+    template<class... Args>
+    constexpr explicit TemporaryValue(Allocator& alloc, Args&&... args);
+    TemporaryValue(TemporaryValue const&)            = delete;
+    TemporaryValue& operator=(TemporaryValue const&) = delete;
+    constexpr ~TemporaryValue();
+
+    constexpr Type& value() noexcept { return m_value; }
+
+private:
+    Allocator& m_alloc;
+    union
+    {
+        Type m_value;
+    };
+};
+
+template<class Type, class Allocator>
+template<class... Args>
+constexpr TemporaryValue<Type, Allocator>::TemporaryValue(Allocator& alloc, Args&&... args)
+    : m_alloc(alloc)
+{
+    pw::uninitialized_construct_using_allocator(&m_value, m_alloc, pw::forward<Args>(args)...);
+}
+
+template<class Type, class Allocator>
+constexpr TemporaryValue<Type, Allocator>::~TemporaryValue()
+{
+    allocator_traits<Allocator>::destroy(m_alloc, &m_value);
+}
+
+} // namespace pw::internal
+#endif /* INCLUDED_PW_INTERNAL_TEMPORARY_VALUE_H */
@@ -0,0 +1,124 @@
+#include <pw/vector>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/*
+ * Compares the growth policies in <pw/vector> by appending n elements
+ * with push_back() and reporting:
+ *
+ * - throughput in millions of elements per second
+ * - peak heap bytes: the most memory live at once, which includes the
+ *   old and new buffers during a reallocation
+ * - slack: the unused fraction of the final capacity()
+ *
+ * Peak heap bytes stands in for peak RSS since RSS only ever goes up
+ * within a process and can't be compared run by run.
+ */
+
+namespace {
+size_t g_live = 0;
+size_t g_peak = 0;
+
+/**
+ * Allocator that selects Policy and tracks bytes in use.  It has no
+ * allocate_at_least() or try_expand() so the policy is measured by
+ * itself.
+ */
+template<class Type, class Policy>
+struct CountingAllocator
+{
+    using value_type    = Type;
+    using growth_policy = Policy;
+
+    template<class Other>
+    struct rebind
+    {
+        using other = CountingAllocator<Other, Policy>;
+    };
+
+    CountingAllocator() = default;
+    template<class Other>
+    CountingAllocator(CountingAllocator<Other, Policy> const&)
+    {
+    }
+
+    Type* allocate(size_t count)
+    {
+        g_live += count * sizeof(Type);
+        g_peak = g_live > g_peak ? g_live : g_peak;
+        return static_cast<Type*>(std::malloc(count * sizeof(Type)));
+    }
+    void deallocate(Type* ptr, size_t count)
+    {
+        g_live -= count * sizeof(Type);
+        std::free(ptr);
+    }
+
+    friend bool operator==(CountingAllocator const&, CountingAllocator const&) { return true; }
+};
+
+struct Wide
+{
+    long values[8];
+};
+
+template<class Type, class Policy>
+void
+run(char const* policy, char const* type, size_t count)
+{
+    using Vector = pw::vector<Type, CountingAllocator<Type, Policy>>;
+    int const repeat = count < 100000 ? 100 : 3;
+
+    double best     = 0;
+    size_t capacity = 0;
+    for (int r = 0; r < repeat; ++r)
+    {
+        g_live = g_peak = 0;
+
+        auto const start = std::chrono::steady_clock::now();
+        {
+            Vector v;
+            for (size_t i = 0; i < count; ++i)
+            {
+                v.push_back(Type { static_cast<long>(i) });
+            }
+            capacity = v.capacity();
+        }
+        std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+        double const rate = static_cast<double>(count) / elapsed.count() / 1e6;
+        best = rate > best ? rate : best;
+    }
+    std::printf("%-12s %-5s %10zu %10.1f %14zu %7.1f%%\n",
+                policy,
+                type,
+                count,
+                best,
+                g_peak,
+                100.0 * static_cast<double>(capacity - count) / static_cast<double>(capacity));
+}
+
+template<class Type>
+void
+run_all(char const* type, size_t count)
+{
+    run<Type, pw::doubling_growth>("doubling", type, count);
+    run<Type, pw::factor_growth<3, 2>>("1.5x", type, count);
+    run<Type, pw::golden_growth>("golden", type, count);
+    run<Type, pw::page_growth<>>("page", type, count);
+    run<Type, pw::size_class_growth>("size_class", type, count);
+}
+} // namespace
+
+int
+main()
+{
+    std::printf("%-12s %-5s %10s %10s %14s %8s\n", "policy", "type", "count", "Melem/s", "peak bytes", "slack");
+    for (size_t count : { size_t { 1000 }, size_t { 100000 }, size_t { 10000000 } })
+    {
+        run_all<long>("long", count);
+        run_all<Wide>("wide", count);
+    }
+    return 0;
+}
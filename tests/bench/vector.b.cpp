@@ -0,0 +1,324 @@
+#include <pw/type_traits>
+#include <pw/vector>
+#include <test_optracker_copyconstructible.h>
+#include <test_throwingtype.h>
+
+#include <benchmark/benchmark.h>
+
+#include <utility>
+#include <vector>
+
+/*
+ * Microbenchmarks for every vector operation.  Each benchmark is
+ * registered for pw::vector and std::vector so they sit next to each
+ * other in the output, e.g.
+ *
+ *   BM_push_back<pw::vector<int>>/10000
+ *   BM_push_back<std::vector<int>>/10000
+ *
+ * Run with `--benchmark_format=json` (or `--benchmark_out=file.json`)
+ * to get output that can be diffed with Google Benchmark's compare.py.
+ */
+
+namespace {
+using pw::test::OpTrackerCopyConstructible;
+using pw::test::ThrowingType;
+
+template<class Type>
+Type
+make(benchmark::IterationCount i)
+{
+    return Type(static_cast<int>(i));
+}
+
+template<class Vector>
+Vector
+make_vector(benchmark::IterationCount count)
+{
+    Vector v;
+    v.reserve(count);
+    for (benchmark::IterationCount i = 0; i < count; ++i)
+    {
+        v.push_back(make<typename Vector::value_type>(i));
+    }
+    return v;
+}
+
+// Sizes for operations linear in size(): 1 to 10^8 for int and 1 to
+// 10^6 for the heavier test types.
+template<class Type>
+void
+linear_sizes(benchmark::internal::Benchmark* bench)
+{
+    bench->RangeMultiplier(100)->Range(1, pw::is_trivially_copyable_v<Type> ? 100'000'000 : 1'000'000);
+}
+
+// Sizes for operations that are quadratic in size()
+template<class Type>
+void
+quadratic_sizes(benchmark::internal::Benchmark* bench)
+{
+    bench->RangeMultiplier(10)->Range(1, 10'000);
+}
+
+template<class Vector>
+void
+BM_push_back(benchmark::State& state)
+{
+    using value_type = Vector::value_type;
+    auto const count = state.range(0);
+
+    for (auto _ : state)
+    {
+        Vector v;
+        for (benchmark::IterationCount i = 0; i < count; ++i)
+        {
+            v.push_back(make<value_type>(i));
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+template<class Vector>
+void
+BM_emplace_back(benchmark::State& state)
+{
+    auto const count = state.range(0);
+
+    for (auto _ : state)
+    {
+        Vector v;
+        for (benchmark::IterationCount i = 0; i < count; ++i)
+        {
+            v.emplace_back(static_cast<int>(i));
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Builds a vector of range(0) elements by inserting each one at the
+// position chosen by Where (0 = front, 1 = middle, 2 = end).
+template<class Vector, int Where>
+void
+BM_insert(benchmark::State& state)
+{
+    using value_type = Vector::value_type;
+    auto const count = state.range(0);
+
+    for (auto _ : state)
+    {
+        Vector v;
+        for (benchmark::IterationCount i = 0; i < count; ++i)
+        {
+            auto const offset = Where == 0 ? 0 : Where == 1 ? v.size() / 2 : v.size();
+            v.insert(v.begin() + offset, make<value_type>(i));
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Empties a vector of range(0) elements by erasing from the middle
+template<class Vector>
+void
+BM_erase(benchmark::State& state)
+{
+    auto const count = state.range(0);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        Vector v = make_vector<Vector>(count);
+        state.ResumeTiming();
+        while (!v.empty())
+        {
+            v.erase(v.begin() + v.size() / 2);
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+template<class Vector>
+void
+BM_reserve(benchmark::State& state)
+{
+    auto const count = state.range(0);
+
+    for (auto _ : state)
+    {
+        Vector v;
+        v.reserve(count);
+        benchmark::DoNotOptimize(v.data());
+    }
+}
+
+template<class Vector>
+void
+BM_resize(benchmark::State& state)
+{
+    using value_type = Vector::value_type;
+    auto const count = state.range(0);
+
+    for (auto _ : state)
+    {
+        Vector v;
+        if constexpr (requires { value_type(); })
+        {
+            v.resize(count);
+        }
+        else
+        {
+            v.resize(count, make<value_type>(0));
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+template<class Vector>
+void
+BM_copy_construct(benchmark::State& state)
+{
+    Vector const source = make_vector<Vector>(state.range(0));
+
+    for (auto _ : state)
+    {
+        Vector v(source);
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Vector>
+void
+BM_move_construct(benchmark::State& state)
+{
+    Vector source = make_vector<Vector>(state.range(0));
+
+    for (auto _ : state)
+    {
+        Vector v(std::move(source));
+        benchmark::DoNotOptimize(v.data());
+        source = std::move(v);
+    }
+}
+
+template<class Vector>
+void
+BM_copy_assign(benchmark::State& state)
+{
+    Vector const source = make_vector<Vector>(state.range(0));
+    Vector       v;
+
+    for (auto _ : state)
+    {
+        v = source;
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Vector>
+void
+BM_move_assign(benchmark::State& state)
+{
+    Vector source = make_vector<Vector>(state.range(0));
+    Vector v;
+
+    for (auto _ : state)
+    {
+        v = std::move(source);
+        benchmark::DoNotOptimize(v.data());
+        source = std::move(v);
+    }
+}
+
+template<class Vector>
+void
+BM_swap(benchmark::State& state)
+{
+    Vector v1 = make_vector<Vector>(state.range(0));
+    Vector v2 = make_vector<Vector>(state.range(0));
+
+    for (auto _ : state)
+    {
+        v1.swap(v2);
+        benchmark::DoNotOptimize(v1.data());
+    }
+}
+
+template<class Vector>
+void
+BM_equal(benchmark::State& state)
+{
+    Vector const v1 = make_vector<Vector>(state.range(0));
+    Vector const v2 = v1;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v1 == v2);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Vector>
+void
+BM_less(benchmark::State& state)
+{
+    Vector const v1 = make_vector<Vector>(state.range(0));
+    Vector const v2 = v1;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v1 < v2);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+#define PW_BENCH(func, sizes, ...)                                                                             \
+    BENCHMARK_TEMPLATE(func, pw::vector<__VA_ARGS__>)->Apply(sizes<__VA_ARGS__>);                              \
+    BENCHMARK_TEMPLATE(func, std::vector<__VA_ARGS__>)->Apply(sizes<__VA_ARGS__>)
+
+#define PW_BENCH_INSERT(where, Type)                                                                           \
+    BENCHMARK_TEMPLATE(BM_insert, pw::vector<Type>, where)->Apply(quadratic_sizes<Type>);                      \
+    BENCHMARK_TEMPLATE(BM_insert, std::vector<Type>, where)->Apply(quadratic_sizes<Type>)
+
+// Operations that only construct, destroy and relocate elements
+#define PW_BENCH_GROW(Type)                                                                                    \
+    PW_BENCH(BM_push_back, linear_sizes, Type);                                                                \
+    PW_BENCH(BM_emplace_back, linear_sizes, Type);                                                             \
+    PW_BENCH(BM_reserve, linear_sizes, Type);                                                                  \
+    PW_BENCH(BM_resize, linear_sizes, Type);                                                                   \
+    PW_BENCH(BM_copy_construct, linear_sizes, Type);                                                           \
+    PW_BENCH(BM_move_construct, linear_sizes, Type);                                                           \
+    PW_BENCH(BM_move_assign, linear_sizes, Type);                                                              \
+    PW_BENCH(BM_swap, linear_sizes, Type)
+
+// Operations that also assign elements
+#define PW_BENCH_ASSIGN(Type)                                                                                  \
+    PW_BENCH_INSERT(0, Type);                                                                                  \
+    PW_BENCH_INSERT(1, Type);                                                                                  \
+    PW_BENCH_INSERT(2, Type);                                                                                  \
+    PW_BENCH(BM_erase, quadratic_sizes, Type);                                                                 \
+    PW_BENCH(BM_copy_assign, linear_sizes, Type)
+
+PW_BENCH_GROW(int);
+PW_BENCH_ASSIGN(int);
+PW_BENCH_GROW(OpTrackerCopyConstructible);
+PW_BENCH_ASSIGN(OpTrackerCopyConstructible);
+// ThrowingType can't be assigned
+PW_BENCH_GROW(ThrowingType);
+
+// ThrowingType has no comparison operators
+PW_BENCH(BM_equal, linear_sizes, unsigned char);
+PW_BENCH(BM_less, linear_sizes, unsigned char);
+PW_BENCH(BM_equal, linear_sizes, int);
+PW_BENCH(BM_less, linear_sizes, int);
+PW_BENCH(BM_equal, linear_sizes, OpTrackerCopyConstructible);
+PW_BENCH(BM_less, linear_sizes, OpTrackerCopyConstructible);
+
+BENCHMARK_MAIN();
@@ -1,6 +1,7 @@
 #ifndef INCLUDED_PW_TEST_TESTTYPE_H
 #define INCLUDED_PW_TEST_TESTTYPE_H
 
+#include <pw/small_vector>
 #include <pw/vector>
 
 #include <pw/impl/memory_resource/pmr_polymorphic_allocator.h>
@@ -36,8 +37,10 @@ using Phase2TestTypeList =
 using TestTypeListAllocatorBase =
     std::tuple<vector<int, allocator_base<int>>, std::vector<int, allocator_base<int>>>;
 
+// small_vector only holds one element inline so the tests still allocate
 using TestTypeListThrowing = std::tuple<vector<ThrowingType, ThrowingAllocator<ThrowingType>>,
-                                        std::vector<ThrowingType, ThrowingAllocator<ThrowingType>>>;
+                                        std::vector<ThrowingType, ThrowingAllocator<ThrowingType>>,
+                                        small_vector<ThrowingType, 1, ThrowingAllocator<ThrowingType>>>;
 using TestTypeListNoAllocator =
     std::tuple<vector<OpTrackerAllocatorNone>, std::vector<pw::test::OpTrackerAllocatorNone>>;
 using TestTypeListAllocatorOnly =
@@ -11,6 +11,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <cstddef>
 #include <limits>
+#include <new>
 
 namespace pw::test {
 
@@ -164,6 +165,21 @@ struct allocator_with_max_size : allocator_base<Type>
     [[nodiscard]] size_type max_size() const { return 12345; }
 };
 
+// Allocator with allocate_at_least() but no nested size_type, like pmr::polymorphic_allocator
+template<class Type>
+struct allocator_with_allocate_at_least
+{
+    using value_type = Type;
+
+    Type* allocate(size_t count) { return static_cast<Type*>(::operator new(count * sizeof(Type))); }
+    void  deallocate(Type* ptr, size_t) { ::operator delete(ptr); }
+
+    allocation_result<Type*, size_t> allocate_at_least(size_t count)
+    {
+        return { allocate(count + 3), count + 3 };
+    }
+};
+
 } // namespace pw::test
 
 SCENARIO("allocator_traits construct", "[allocator_traits][construct]")
@@ -700,6 +716,116 @@ SCENARIO("allocator_traits::allocate_at_least returns at least n elements",
             }
         }
     }
+    GIVEN("An allocator with allocate_at_least() and no size_type")
+    {
+        using Alloc  = pw::test::allocator_with_allocate_at_least<int>;
+        using Traits = pw::allocator_traits<Alloc>;
+        Alloc alloc;
+
+        REQUIRE(pw::has_allocate_at_least_v<Alloc>);
+        WHEN("allocate_at_least(5) is called")
+        {
+            auto result = Traits::allocate_at_least(alloc, 5);
+            THEN("the allocator's own count is returned")
+            {
+                REQUIRE(result.count == 8);
+                Traits::deallocate(alloc, result.ptr, result.count);
+            }
+        }
+    }
+}
+
+// ─── try_expand (expandable allocator protocol) ──────────────────────────────
+
+SCENARIO("allocator_traits::try_expand grows an allocation", "[allocator_traits][try_expand]")
+{
+    GIVEN("A pw::allocator<int>")
+    {
+        using Traits = pw::allocator_traits<pw::allocator<int>>;
+        pw::allocator<int> alloc;
+
+        REQUIRE(pw::has_try_expand_v<pw::allocator<int>>);
+        WHEN("try_expand() grows 4 elements to 1000")
+        {
+            int* p = Traits::allocate(alloc, 4);
+            for (int i = 0; i < 4; ++i)
+            {
+                p[i] = i + 10;
+            }
+            int* q = Traits::try_expand(alloc, p, 4, 1000);
+            THEN("the grown memory holds the original values")
+            {
+                REQUIRE(q != nullptr);
+                REQUIRE(q[0] == 10);
+                REQUIRE(q[3] == 13);
+                q[999] = 1;
+                Traits::deallocate(alloc, q, 1000);
+            }
+        }
+    }
+    GIVEN("An allocator without try_expand()")
+    {
+        using Alloc  = pw::test::allocator_base<int>;
+        using Traits = pw::allocator_traits<Alloc>;
+        Alloc alloc;
+
+        REQUIRE(!pw::has_try_expand_v<Alloc>);
+        WHEN("try_expand() is called")
+        {
+            int* p = Traits::allocate(alloc, 4);
+            THEN("nullptr is returned and the memory is unchanged")
+            {
+                REQUIRE(Traits::try_expand(alloc, p, 4, 8) == nullptr);
+                Traits::deallocate(alloc, p, 4);
+            }
+        }
+    }
+}
+
+// ─── allocate_zeroed (zeroed allocation protocol) ────────────────────────────
+
+SCENARIO("allocator_traits::allocate_zeroed returns zeroed memory", "[allocator_traits][allocate_zeroed]")
+{
+    GIVEN("A pw::allocator<double>")
+    {
+        using Traits = pw::allocator_traits<pw::allocator<double>>;
+        pw::allocator<double> alloc;
+
+        REQUIRE(pw::has_allocate_zeroed_v<pw::allocator<double>>);
+        WHEN("allocate_zeroed() is called for 100000 elements")
+        {
+            auto const result = Traits::allocate_zeroed(alloc, 100000);
+            THEN("every element is zero")
+            {
+                REQUIRE(result.ptr != nullptr);
+                REQUIRE(result.count >= 100000);
+                size_t zeros = 0;
+                for (size_t index = 0; index < result.count; ++index)
+                {
+                    zeros += result.ptr[index] == 0.0;
+                }
+                REQUIRE(zeros == result.count);
+                Traits::deallocate(alloc, result.ptr, result.count);
+            }
+        }
+    }
+    GIVEN("An allocator without allocate_zeroed()")
+    {
+        using Alloc  = pw::test::allocator_base<int>;
+        using Traits = pw::allocator_traits<Alloc>;
+        Alloc alloc;
+
+        REQUIRE(!pw::has_allocate_zeroed_v<Alloc>);
+        WHEN("allocate_zeroed() is called")
+        {
+            auto const result = Traits::allocate_zeroed(alloc, 4);
+            THEN("nothing is allocated")
+            {
+                REQUIRE(result.ptr == nullptr);
+                REQUIRE(result.count == 0);
+            }
+        }
+    }
 }
 
 // ─── rebind_alloc / rebind_traits ────────────────────────────────────────────
@@ -0,0 +1,147 @@
+#include <pw/vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <new>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * Constructs in parallel once there are 64 bytes of elements
+ */
+template<class Type>
+struct ParallelAllocator
+{
+    using value_type          = Type;
+    using construction_policy = pw::parallel_construction<64>;
+
+    ParallelAllocator() = default;
+    template<class Other>
+    ParallelAllocator(ParallelAllocator<Other> const&)
+    {
+    }
+
+    Type* allocate(size_t count) { return static_cast<Type*>(::operator new(count * sizeof(Type))); }
+    void  deallocate(Type* ptr, size_t) { ::operator delete(ptr); }
+
+    friend bool operator==(ParallelAllocator const&, ParallelAllocator const&) { return true; }
+};
+
+/**
+ * Counts live objects and throws from the copy constructor once
+ * s_copies_left reaches zero
+ */
+struct Counted
+{
+    static inline std::atomic<long> s_live { 0 };
+    static inline std::atomic<long> s_copies_left { -1 };
+
+    explicit Counted(int v = 7)
+        : value(v)
+    {
+        ++s_live;
+    }
+    Counted(Counted const& other)
+        : value(other.value)
+    {
+        if (s_copies_left.fetch_sub(1) == 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+        ++s_live;
+    }
+    Counted(Counted&& other) noexcept
+        : value(other.value)
+    {
+        ++s_live;
+    }
+    ~Counted() { --s_live; }
+
+    int value;
+};
+
+template<class Type>
+using ParallelVector = pw::vector<Type, ParallelAllocator<Type>>;
+
+template<class Vector>
+bool
+all_equal(Vector const& vec, int value)
+{
+    for (auto const& element : vec)
+    {
+        if (element.value != value)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("construction_policy defaults to sequential", "[vector][construction_policy]")
+{
+    using Storage = pw::internal::Storage<int>;
+    STATIC_REQUIRE(pw::is_same_v<Storage::construction_policy, pw::sequential_construction>);
+    STATIC_REQUIRE(pw::is_same_v<pw::internal::Storage<int, ParallelAllocator<int>>::construction_policy,
+                                 pw::parallel_construction<64>>);
+}
+
+TEST_CASE("parallel construction", "[vector][construction_policy]")
+{
+    constexpr size_t count = 10'000;
+    Counted::s_live        = 0;
+    Counted::s_copies_left = -1;
+
+    SECTION("vector(count, value), vector(count) and the copy constructor")
+    {
+        {
+            ParallelVector<Counted> filled(count, Counted(3));
+            ParallelVector<Counted> defaulted(count);
+            ParallelVector<Counted> copy(filled);
+            REQUIRE(filled.size() == count);
+            REQUIRE(defaulted.size() == count);
+            REQUIRE(copy.size() == count);
+            REQUIRE(all_equal(filled, 3));
+            REQUIRE(all_equal(defaulted, 7));
+            REQUIRE(all_equal(copy, 3));
+            REQUIRE(Counted::s_live == 3 * static_cast<long>(count));
+        }
+        REQUIRE(Counted::s_live == 0);
+    }
+    SECTION("reserve() moves and relocates the elements")
+    {
+        ParallelVector<Counted> counted(count, Counted(4));
+        counted.reserve(2 * count);
+        REQUIRE(counted.capacity() == 2 * count);
+        REQUIRE(all_equal(counted, 4));
+        REQUIRE(Counted::s_live == static_cast<long>(count));
+
+        ParallelVector<int> ints(count);
+        for (size_t index = 0; index < count; ++index)
+        {
+            ints[index] = static_cast<int>(index);
+        }
+        ints.reserve(3 * count);
+        bool in_order = true;
+        for (size_t index = 0; index < count; ++index)
+        {
+            in_order = in_order && ints[index] == static_cast<int>(index);
+        }
+        REQUIRE(in_order);
+    }
+    SECTION("A copy constructor that throws part way leaves nothing behind")
+    {
+        ParallelVector<Counted> original(count, Counted(5));
+        REQUIRE(Counted::s_live == static_cast<long>(count));
+
+        Counted::s_copies_left = count / 2;
+        REQUIRE_THROWS_AS(ParallelVector<Counted>(original), std::runtime_error);
+        Counted::s_copies_left = -1;
+
+        REQUIRE(Counted::s_live == static_cast<long>(count));
+        REQUIRE(original.size() == count);
+        REQUIRE(all_equal(original, 5));
+    }
+}
@@ -0,0 +1,205 @@
+#include <pw/algorithm>
+#include <pw/iterator>
+#include <pw/memory>
+#include <pw/vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <list>
+#include <string>
+#include <vector>
+
+namespace {
+/**
+ * A wrapped pointer that says it is contiguous, the way a checked or
+ * const_iterator wrapper would.
+ */
+template<class Type>
+struct Wrapped
+{
+    using iterator_concept  = pw::contiguous_iterator_tag;
+    using iterator_category = pw::random_access_iterator_tag;
+    using value_type        = Type;
+    using difference_type   = pw::ptrdiff_t;
+    using pointer           = Type*;
+    using reference         = Type&;
+
+    Type* ptr = nullptr;
+
+    reference operator*() const { return *ptr; }
+    pointer   operator->() const { return ptr; }
+    reference operator[](difference_type n) const { return ptr[n]; }
+    Wrapped&  operator++()
+    {
+        ++ptr;
+        return *this;
+    }
+    Wrapped& operator--()
+    {
+        --ptr;
+        return *this;
+    }
+    Wrapped operator++(int)
+    {
+        Wrapped old = *this;
+        ++ptr;
+        return old;
+    }
+    Wrapped& operator+=(difference_type n)
+    {
+        ptr += n;
+        return *this;
+    }
+    Wrapped         operator+(difference_type n) const { return Wrapped { ptr + n }; }
+    Wrapped         operator-(difference_type n) const { return Wrapped { ptr - n }; }
+    difference_type operator-(Wrapped const& other) const { return ptr - other.ptr; }
+    bool            operator==(Wrapped const& other) const { return ptr == other.ptr; }
+    bool            operator!=(Wrapped const& other) const { return ptr != other.ptr; }
+};
+} // namespace
+
+SCENARIO("contiguous_iterator_tag and contiguous_iterator", "[iterator][contiguous_iterator]")
+{
+    GIVEN("Pointers, wrapped pointers and other iterators")
+    {
+        THEN("Only contiguous ones satisfy contiguous_iterator")
+        {
+            using Tag = pw::contiguous_iterator_tag;
+            STATIC_REQUIRE(pw::is_base_of<pw::random_access_iterator_tag, Tag>::value);
+            STATIC_REQUIRE(pw::is_same<pw::iterator_traits<int*>::iterator_concept, Tag>::value);
+            STATIC_REQUIRE(pw::contiguous_iterator<int*>);
+            STATIC_REQUIRE(pw::contiguous_iterator<int const*>);
+            STATIC_REQUIRE(pw::contiguous_iterator<Wrapped<int>>);
+            STATIC_REQUIRE(pw::contiguous_iterator<std::vector<int>::iterator>);
+            STATIC_REQUIRE_FALSE(pw::contiguous_iterator<std::list<int>::iterator>);
+            STATIC_REQUIRE_FALSE(pw::contiguous_iterator<pw::reverse_iterator<int*>>);
+            STATIC_REQUIRE_FALSE(pw::contiguous_iterator<pw::reverse_iterator<Wrapped<int>>>);
+        }
+        THEN("contiguous_range matches containers with contiguous iterators")
+        {
+            STATIC_REQUIRE(pw::contiguous_range<pw::vector<int>>);
+            STATIC_REQUIRE(pw::contiguous_range<pw::vector<int> const>);
+            STATIC_REQUIRE(pw::contiguous_range<std::string>);
+            STATIC_REQUIRE_FALSE(pw::contiguous_range<std::list<int>>);
+            STATIC_REQUIRE_FALSE(pw::contiguous_range<int>);
+        }
+        THEN("The bulk memory traits accept them")
+        {
+            STATIC_REQUIRE(pw::internal::is_bitwise_copyable_range_v<Wrapped<int>, int*>);
+            STATIC_REQUIRE(pw::internal::is_bitwise_copyable_range_v<std::vector<int>::const_iterator, int*>);
+            STATIC_REQUIRE(pw::internal::is_bitwise_fillable_v<Wrapped<char>, int>);
+            STATIC_REQUIRE(pw::internal::is_bitwise_range_v<Wrapped<int>, int const*>);
+            STATIC_REQUIRE_FALSE(pw::internal::is_bitwise_copyable_range_v<pw::reverse_iterator<int*>, int*>);
+            using ConstIterator = std::vector<int>::const_iterator;
+            STATIC_REQUIRE_FALSE(pw::internal::is_bitwise_copyable_range_v<int*, ConstIterator>);
+        }
+    }
+}
+
+namespace {
+/**
+ * A fancy pointer whose operator->() and pointer_traits disagree so
+ * a test can tell which one to_address() used.
+ */
+struct Disagreeing
+{
+    int* ptr = nullptr;
+
+    int* operator->() const { return ptr + 1; }
+};
+
+/**
+ * Neither a template nor has an element_type so only operator->() works
+ */
+struct Plain
+{
+    int* ptr = nullptr;
+
+    int* operator->() const { return ptr; }
+};
+} // namespace
+
+template<>
+struct pw::pointer_traits<Disagreeing>
+{
+    using pointer         = Disagreeing;
+    using element_type    = int;
+    using difference_type = pw::ptrdiff_t;
+
+    static constexpr int* to_address(Disagreeing p) noexcept { return p.ptr; }
+};
+
+SCENARIO("to_address()", "[memory][to_address]")
+{
+    GIVEN("An array and a std::vector")
+    {
+        int              values[3] = { 1, 2, 3 };
+        std::vector<int> vec { 4, 5, 6 };
+
+        THEN("A pointer is its own address")
+        {
+            REQUIRE(pw::to_address(&values[1]) == &values[1]);
+            REQUIRE(pw::pointer_traits<int*>::to_address(&values[2]) == &values[2]);
+        }
+        THEN("Iterators give the address of their element, including end()")
+        {
+            REQUIRE(pw::to_address(Wrapped<int> { &values[0] }) == &values[0]);
+            REQUIRE(pw::to_address(vec.begin()) == vec.data());
+            REQUIRE(pw::to_address(vec.end()) == vec.data() + vec.size());
+        }
+        THEN("pointer_traits<Ptr>::to_address() is tried before operator->()")
+        {
+            REQUIRE(pw::to_address(Disagreeing { &values[0] }) == &values[0]);
+            REQUIRE(pw::to_address(Plain { &values[2] }) == &values[2]);
+        }
+    }
+}
+
+SCENARIO("Wrapped contiguous iterators use the bulk paths", "[iterator][contiguous_iterator]")
+{
+    GIVEN("An array and wrapped iterators over it")
+    {
+        int                values[5] = { 1, 2, 3, 4, 5 };
+        Wrapped<int> const begin { &values[0] };
+        Wrapped<int> const end { &values[5] };
+
+        WHEN("distance() and advance() are used")
+        {
+            Wrapped<int> middle = begin;
+            pw::advance(middle, 2);
+            THEN("They take constant time steps")
+            {
+                REQUIRE(pw::distance(begin, end) == 5);
+                REQUIRE(*middle == 3);
+            }
+        }
+        WHEN("The range is copied, filled and compared")
+        {
+            int  copied[5] = {};
+            int* last      = pw::copy(begin, end, &copied[0]);
+            THEN("The results match the element by element versions")
+            {
+                REQUIRE(last == &copied[5]);
+                REQUIRE(pw::equal(begin, end, &copied[0], &copied[5]));
+                pw::fill(begin, begin + 2, 9);
+                REQUIRE(values[1] == 9);
+                REQUIRE(values[2] == 3);
+                REQUIRE_FALSE(pw::equal(begin, end, &copied[0], &copied[5]));
+                REQUIRE(pw::lexicographical_compare(&copied[0], &copied[5], begin, end));
+            }
+        }
+        WHEN("A vector is constructed from them")
+        {
+            pw::vector<int>        vec(begin, end);
+            std::vector<int> const source { 7, 8, 9 };
+            pw::vector<int>        from_std(source.begin(), source.end());
+            THEN("It holds the elements")
+            {
+                REQUIRE(vec.size() == 5);
+                REQUIRE(vec[4] == 5);
+                REQUIRE(from_std.size() == 3);
+                REQUIRE(from_std[2] == 9);
+            }
+        }
+    }
+}
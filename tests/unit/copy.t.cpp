@@ -1,4 +1,6 @@
 #include <pw/impl/algorithm/copy.h>
+#include <pw/impl/algorithm/move.h>
+#include <pw/impl/algorithm/move_backward.h>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -20,3 +22,76 @@ SCENARIO("copy", "[copy]")
         }
     }
 }
+
+namespace {
+struct Point
+{
+    int x;
+    int y;
+};
+
+constexpr int
+constexpr_copy()
+{
+    int val[3] = { 1, 2, 3 };
+    int dst[3] = {};
+    pw::copy(&val[0], &val[3], &dst[0]);
+    pw::move_backward(&dst[0], &dst[2], &dst[3]);
+    return dst[0] * 100 + dst[1] * 10 + dst[2];
+}
+} // namespace
+
+SCENARIO("copy, move and move_backward of trivially copyable ranges", "[copy][move]")
+{
+    STATIC_REQUIRE(pw::internal::is_bitwise_copyable_range_v<int const*, int*>);
+    STATIC_REQUIRE(pw::internal::is_bitwise_copyable_range_v<Point*, Point*>);
+    STATIC_REQUIRE_FALSE(pw::internal::is_bitwise_copyable_range_v<int*, long*>);
+    STATIC_REQUIRE_FALSE(pw::internal::is_bitwise_copyable_range_v<int*, int const*>);
+    STATIC_REQUIRE(constexpr_copy() == 112);
+
+    GIVEN("An array of Point")
+    {
+        Point val[4] = { { 1, 2 }, { 3, 4 }, { 5, 6 }, { 7, 8 } };
+        Point dst[4] = {};
+
+        WHEN("val is copied")
+        {
+            Point* end = pw::copy(&val[0], &val[4], &dst[0]);
+            THEN("every element is copied")
+            {
+                REQUIRE(end == &dst[4]);
+                REQUIRE(dst[0].x == 1);
+                REQUIRE(dst[3].y == 8);
+            }
+        }
+        WHEN("an empty range is copied")
+        {
+            Point* end = pw::copy(&val[0], &val[0], &dst[0]);
+            THEN("nothing changes")
+            {
+                REQUIRE(end == &dst[0]);
+                REQUIRE(dst[0].x == 0);
+            }
+        }
+        WHEN("val is moved down by one")
+        {
+            Point* end = pw::move(&val[1], &val[4], &val[0]);
+            THEN("the overlapping ranges are handled")
+            {
+                REQUIRE(end == &val[3]);
+                REQUIRE(val[0].x == 3);
+                REQUIRE(val[2].x == 7);
+            }
+        }
+        WHEN("val is moved up by one with move_backward()")
+        {
+            Point* begin = pw::move_backward(&val[0], &val[3], &val[4]);
+            THEN("the overlapping ranges are handled")
+            {
+                REQUIRE(begin == &val[1]);
+                REQUIRE(val[1].x == 1);
+                REQUIRE(val[3].x == 5);
+            }
+        }
+    }
+}
@@ -59,3 +59,43 @@ SCENARIO("pw::equal() compares integer arrays", "[equal]")
         }
     }
 }
+
+SCENARIO("pw::equal() compares long ranges with memcmp()", "[equal]")
+{
+    GIVEN("Two identical arrays longer than a memcmp() block")
+    {
+        long a[1000];
+        long b[1000];
+        for (int i = 0; i < 1000; ++i)
+        {
+            a[i] = b[i] = i * 7;
+        }
+        THEN("They are equal")
+        {
+            REQUIRE(pw::equal(&a[0], &a[1000], &b[0], &b[1000]));
+        }
+        WHEN("The last element differs")
+        {
+            b[999] = -1;
+            THEN("They are not equal")
+            {
+                REQUIRE_FALSE(pw::equal(&a[0], &a[1000], &b[0], &b[1000]));
+            }
+        }
+    }
+    GIVEN("Arrays of const and non-const char")
+    {
+        char const a[] = "abcdef";
+        char       b[] = "abcdef";
+        THEN("They are equal")
+        {
+            REQUIRE(pw::equal(&a[0], &a[6], &b[0], &b[6]));
+        }
+    }
+    GIVEN("A constant expression")
+    {
+        constexpr int a[] = { 1, 2, 3 };
+        constexpr int b[] = { 1, 2, 3 };
+        STATIC_REQUIRE(pw::equal(&a[0], &a[3], &b[0], &b[3]));
+    }
+}
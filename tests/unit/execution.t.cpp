@@ -0,0 +1,163 @@
+#include <pw/impl/algorithm/copy_policy.h>
+#include <pw/impl/algorithm/equal_policy.h>
+#include <pw/impl/algorithm/fill_policy.h>
+#include <pw/impl/algorithm/for_each_policy.h>
+#include <pw/impl/execution/execution_policy.h>
+#include <pw/impl/execution/thread_pool.h>
+#include <pw/impl/vector/vector_decl.h>
+#include <pw/impl/vector/vector_defn.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+
+SCENARIO("execution policies", "[execution]")
+{
+    GIVEN("The policy objects")
+    {
+        THEN("They are execution policies and only par and par_unseq are parallel")
+        {
+            STATIC_REQUIRE(pw::is_execution_policy_v<pw::execution::sequenced_policy>);
+            STATIC_REQUIRE(pw::is_execution_policy_v<pw::execution::parallel_unsequenced_policy>);
+            STATIC_REQUIRE_FALSE(pw::is_execution_policy_v<int>);
+            STATIC_REQUIRE(pw::internal::is_parallel_policy_v<decltype(pw::execution::par)>);
+            STATIC_REQUIRE(pw::internal::is_parallel_policy_v<decltype(pw::execution::par_unseq)&>);
+            STATIC_REQUIRE_FALSE(pw::internal::is_parallel_policy_v<decltype(pw::execution::seq)>);
+            STATIC_REQUIRE_FALSE(pw::internal::is_parallel_policy_v<decltype(pw::execution::unseq)>);
+        }
+    }
+}
+
+SCENARIO("parallel_run() covers the range", "[execution]")
+{
+    GIVEN("A range that is split into many chunks")
+    {
+        std::size_t const                    count = 64 * pw::internal::parallel_grain + 17;
+        std::unique_ptr<std::atomic<int>[]> visits(new std::atomic<int>[count] {});
+        std::mutex                           mutex;
+        std::set<std::thread::id>            threads;
+
+        WHEN("parallel_for() runs with par")
+        {
+            pw::internal::parallel_for(pw::execution::par, count, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t index = begin; index < end; ++index)
+                {
+                    visits[index].fetch_add(1, std::memory_order_relaxed);
+                }
+                std::lock_guard lock(mutex);
+                threads.insert(std::this_thread::get_id());
+            });
+            THEN("Every index is visited exactly once")
+            {
+                std::size_t once = 0;
+                for (std::size_t index = 0; index < count; ++index)
+                {
+                    once += visits[index].load() == 1;
+                }
+                REQUIRE(once == count);
+                REQUIRE(threads.size() <= pw::internal::parallel_concurrency());
+                REQUIRE(threads.size() >= 1);
+            }
+        }
+        WHEN("parallel_for() is called from inside a parallel run")
+        {
+            std::atomic<std::size_t> inner { 0 };
+            pw::internal::parallel_for(pw::execution::par, count, [&](std::size_t begin, std::size_t end) {
+                auto count_inner = [&inner](std::size_t first, std::size_t last) {
+                    inner.fetch_add(last - first, std::memory_order_relaxed);
+                };
+                pw::internal::parallel_for(pw::execution::par, end - begin, count_inner);
+            });
+            THEN("The nested calls run inline and still cover everything")
+            {
+                REQUIRE(inner.load() == count);
+            }
+        }
+        WHEN("parallel_for() runs with seq")
+        {
+            pw::internal::parallel_for(pw::execution::seq, count, [&](std::size_t begin, std::size_t end) {
+                std::lock_guard lock(mutex);
+                threads.insert(std::this_thread::get_id());
+                REQUIRE(begin == 0);
+                REQUIRE(end == count);
+            });
+            THEN("It is one call on this thread")
+            {
+                REQUIRE(threads.size() == 1);
+                REQUIRE(*threads.begin() == std::this_thread::get_id());
+            }
+        }
+    }
+}
+
+SCENARIO("parallel algorithms", "[execution]")
+{
+    GIVEN("Large vectors of int")
+    {
+        std::size_t const count = 40 * pw::internal::parallel_grain + 3;
+        pw::vector<int>   src(count);
+        pw::vector<int>   dst(count);
+
+        WHEN("fill() runs with par")
+        {
+            pw::fill(pw::execution::par, src.begin(), src.end(), 7);
+            THEN("Every element is set")
+            {
+                std::size_t sevens = 0;
+                for (int value : src)
+                {
+                    sevens += value == 7;
+                }
+                REQUIRE(sevens == count);
+            }
+        }
+        WHEN("for_each() numbers the elements and copy() copies them")
+        {
+            pw::for_each(pw::execution::par_unseq, src.begin(), src.end(), [&src](int& value) {
+                value = static_cast<int>(&value - src.data());
+            });
+            auto end = pw::copy(pw::execution::par, src.begin(), src.end(), dst.begin());
+            THEN("dst matches src")
+            {
+                REQUIRE(end == dst.end());
+                REQUIRE(dst[0] == 0);
+                REQUIRE(dst[count - 1] == static_cast<int>(count - 1));
+                REQUIRE(pw::equal(pw::execution::par, src.begin(), src.end(), dst.begin(), dst.end()));
+                REQUIRE(pw::equal(src.begin(), src.end(), dst.begin(), dst.end()));
+            }
+            AND_WHEN("One element of dst is changed")
+            {
+                dst[count / 3] = -1;
+                THEN("par equal() finds it")
+                {
+                    auto const par = pw::execution::par;
+                    REQUIRE_FALSE(pw::equal(par, src.begin(), src.end(), dst.begin(), dst.end()));
+                    REQUIRE_FALSE(pw::equal(par, src.begin(), src.end(), dst.begin(), dst.end() - 1));
+                }
+            }
+        }
+    }
+    GIVEN("A std::list which isn't random access")
+    {
+        std::list<int> values(5, 1);
+        WHEN("The policy overloads are used")
+        {
+            pw::fill(pw::execution::par, values.begin(), values.end(), 3);
+            int sum = 0;
+            pw::for_each(pw::execution::par, values.begin(), values.end(), [&sum](int value) {
+                sum += value;
+            });
+            THEN("They run serially")
+            {
+                REQUIRE(sum == 15);
+                REQUIRE(pw::equal(pw::execution::seq, values.begin(), values.end(), values.begin(),
+                                  values.end()));
+            }
+        }
+    }
+}
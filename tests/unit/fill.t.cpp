@@ -0,0 +1,100 @@
+#include <pw/impl/algorithm/fill.h>
+#include <pw/impl/algorithm/fill_n.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+
+namespace {
+struct Rgb
+{
+    unsigned char r;
+    unsigned char g;
+    unsigned char b;
+};
+
+constexpr int
+constexpr_fill()
+{
+    int values[4] = {};
+    pw::fill(&values[0], &values[4], 3);
+    pw::fill_n(&values[0], 2, 5);
+    return values[0] + values[1] + values[2] + values[3];
+}
+} // namespace
+
+SCENARIO("fill() and fill_n()", "[fill]")
+{
+    STATIC_REQUIRE(pw::internal::is_bitwise_fillable_v<int*, int>);
+    STATIC_REQUIRE(pw::internal::is_bitwise_fillable_v<char*, int>);
+    STATIC_REQUIRE(pw::internal::is_bitwise_fillable_v<Rgb*, Rgb>);
+    STATIC_REQUIRE_FALSE(pw::internal::is_bitwise_fillable_v<int const*, int>);
+    STATIC_REQUIRE_FALSE(pw::internal::is_bitwise_fillable_v<double*, int>);
+    STATIC_REQUIRE(constexpr_fill() == 16);
+
+    GIVEN("An array of int")
+    {
+        int values[100] = {};
+
+        WHEN("It is filled with a value whose bytes are all the same")
+        {
+            pw::fill(&values[0], &values[100], -1);
+            THEN("every element is set")
+            {
+                REQUIRE(values[0] == -1);
+                REQUIRE(values[99] == -1);
+            }
+        }
+        WHEN("It is filled with a value whose bytes differ")
+        {
+            pw::fill(&values[0], &values[100], 0x01020304);
+            THEN("every element is set")
+            {
+                REQUIRE(values[0] == 0x01020304);
+                REQUIRE(values[99] == 0x01020304);
+            }
+        }
+        WHEN("fill_n() sets part of it")
+        {
+            int* end = pw::fill_n(&values[10], 20, 7);
+            THEN("only count elements are set")
+            {
+                REQUIRE(end == &values[30]);
+                REQUIRE(values[9] == 0);
+                REQUIRE(values[10] == 7);
+                REQUIRE(values[29] == 7);
+                REQUIRE(values[30] == 0);
+            }
+        }
+        WHEN("fill_n() is given a negative count")
+        {
+            int* end = pw::fill_n(&values[0], -5, 7);
+            THEN("nothing is set")
+            {
+                REQUIRE(end == &values[0]);
+                REQUIRE(values[0] == 0);
+            }
+        }
+    }
+    GIVEN("Arrays of char and a struct")
+    {
+        char          text[16]  = {};
+        Rgb           pixels[5] = {};
+        std::uint64_t wide[3]   = {};
+
+        WHEN("They are filled")
+        {
+            pw::fill(&text[0], &text[15], 'x');
+            pw::fill(&pixels[0], &pixels[5], Rgb { 1, 2, 3 });
+            pw::fill_n(&wide[0], 3, 0x0101010101010101u);
+            THEN("every element is set")
+            {
+                REQUIRE(text[0] == 'x');
+                REQUIRE(text[14] == 'x');
+                REQUIRE(text[15] == 0);
+                REQUIRE(pixels[4].b == 3);
+                REQUIRE(wide[2] == 0x0101010101010101u);
+            }
+        }
+    }
+}
@@ -0,0 +1,136 @@
+#include <pw/vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <new>
+
+namespace {
+/**
+ * An allocator that hands out exactly what is asked for so the
+ * capacities vector grows through are predictable.
+ */
+template<class Type>
+struct ExactAllocator
+{
+    using value_type = Type;
+
+    ExactAllocator() = default;
+    template<class Other>
+    ExactAllocator(ExactAllocator<Other> const&)
+    {
+    }
+
+    Type* allocate(size_t count) { return static_cast<Type*>(::operator new(count * sizeof(Type))); }
+    void  deallocate(Type* ptr, size_t) { ::operator delete(ptr); }
+
+    friend bool operator==(ExactAllocator const&, ExactAllocator const&) { return true; }
+};
+
+template<class Type>
+struct GoldenAllocator : ExactAllocator<Type>
+{
+    using growth_policy = pw::golden_growth;
+
+    GoldenAllocator() = default;
+    template<class Other>
+    GoldenAllocator(GoldenAllocator<Other> const&)
+    {
+    }
+};
+} // namespace
+
+TEST_CASE("growth policies compute the next capacity", "[growth_policy]")
+{
+    SECTION("doubling_growth")
+    {
+        STATIC_REQUIRE(pw::doubling_growth::next_capacity(0, 4) == 1);
+        STATIC_REQUIRE(pw::doubling_growth::next_capacity(1, 4) == 2);
+        STATIC_REQUIRE(pw::doubling_growth::next_capacity(10, 4) == 20);
+    }
+    SECTION("golden_growth")
+    {
+        STATIC_REQUIRE(pw::golden_growth::next_capacity(0, 4) == 1);
+        STATIC_REQUIRE(pw::golden_growth::next_capacity(1, 4) == 2);
+        STATIC_REQUIRE(pw::golden_growth::next_capacity(8, 4) == 13);
+        STATIC_REQUIRE(pw::golden_growth::next_capacity(100, 4) == 162);
+    }
+    SECTION("factor_growth<3, 2>")
+    {
+        STATIC_REQUIRE(pw::factor_growth<3, 2>::next_capacity(2, 4) == 3);
+        STATIC_REQUIRE(pw::factor_growth<3, 2>::next_capacity(3, 4) == 4);
+        STATIC_REQUIRE(pw::factor_growth<3, 2>::next_capacity(100, 4) == 150);
+    }
+    SECTION("page_growth")
+    {
+        STATIC_REQUIRE(pw::page_growth<>::next_capacity(1, 4) == 1024);
+        STATIC_REQUIRE(pw::page_growth<>::next_capacity(1024, 4) == 2048);
+        STATIC_REQUIRE(pw::page_growth<>::next_capacity(1500, 4) == 3072);
+        STATIC_REQUIRE(pw::page_growth<>::next_capacity(1, 5000) == 2);
+    }
+    SECTION("size_class_growth")
+    {
+        STATIC_REQUIRE(pw::size_class_growth::next_capacity(0, 4) == 4);
+        STATIC_REQUIRE(pw::size_class_growth::next_capacity(32, 4) == 48);
+        STATIC_REQUIRE(pw::size_class_growth::next_capacity(48, 4) == 80);
+    }
+    SECTION("size_class_index")
+    {
+        STATIC_REQUIRE(pw::internal::size_class_index(1) == 0);
+        STATIC_REQUIRE(pw::internal::size_class_index(16) == 0);
+        STATIC_REQUIRE(pw::internal::size_class_index(17) == 1);
+        STATIC_REQUIRE(pw::internal::size_class_index(128) == 7);
+        STATIC_REQUIRE(pw::internal::size_class_index(129) == 8);
+        STATIC_REQUIRE(pw::internal::size_class_index(256) == 11);
+        STATIC_REQUIRE(pw::internal::size_class_index(257) == 12);
+        STATIC_REQUIRE(pw::internal::size_class_index(4096) == 27);
+        STATIC_REQUIRE(pw::internal::size_class_bytes(0) == 16);
+        STATIC_REQUIRE(pw::internal::size_class_bytes(8) == 160);
+        STATIC_REQUIRE(pw::internal::size_class_bytes(11) == 256);
+        STATIC_REQUIRE(pw::internal::size_class_bytes(27) == 4096);
+    }
+    SECTION("allocation_size")
+    {
+        STATIC_REQUIRE(pw::internal::allocation_size(200) == 224);
+        STATIC_REQUIRE(pw::internal::allocation_size(128 * 1024) == 128 * 1024);
+        STATIC_REQUIRE(pw::internal::allocation_size(128 * 1024 + 1) == 132 * 1024);
+
+        constexpr pw::size_t gib = pw::size_t { 1 } << 30;
+        STATIC_REQUIRE(pw::internal::allocation_size(gib + 1) == gib + 4096);
+    }
+}
+
+TEST_CASE("vector grows using the allocator's growth_policy", "[vector][growth_policy]")
+{
+    GIVEN("A vector whose allocator uses golden_growth")
+    {
+        pw::vector<int, GoldenAllocator<int>> v;
+        WHEN("push_back() is called until it reallocates")
+        {
+            v.reserve(8);
+            for (int i = 0; i < 9; ++i)
+            {
+                v.push_back(i);
+            }
+            THEN("capacity() comes from the policy")
+            {
+                REQUIRE(v.capacity() == 13);
+                REQUIRE(v.size() == 9);
+                REQUIRE(v.back() == 8);
+            }
+        }
+    }
+    GIVEN("A vector whose allocator has no growth_policy")
+    {
+        pw::vector<int, ExactAllocator<int>> v;
+        WHEN("push_back() is called")
+        {
+            v.push_back(1);
+            v.push_back(2);
+            v.push_back(3);
+            THEN("capacity() doubles")
+            {
+                REQUIRE(v.capacity() == 4);
+            }
+        }
+    }
+}
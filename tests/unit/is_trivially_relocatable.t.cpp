@@ -0,0 +1,77 @@
+#include <pw/impl/type_traits/is_trivially_relocatable.h>
+
+#include <pw/impl/type_traits/bool_type.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+
+namespace {
+struct Handle
+{
+    explicit Handle(int* p)
+        : m_p(p)
+    {
+    }
+    Handle(Handle&& other) noexcept
+        : m_p(other.m_p)
+    {
+        other.m_p = nullptr;
+    }
+    ~Handle() { delete m_p; }
+
+    int* m_p;
+};
+} // namespace
+
+template<>
+struct pw::is_trivially_relocatable<Handle> : pw::true_type
+{
+};
+
+SCENARIO("is_trivially_relocatable", "[type_traits]")
+{
+    GIVEN("A trivially copyable struct")
+    {
+        struct Point
+        {
+            int x;
+            int y;
+        };
+        THEN("is_trivially_copyable is true")
+        {
+            REQUIRE(pw::is_trivially_copyable_v<Point>);
+        }
+        THEN("is_trivially_relocatable is true")
+        {
+            REQUIRE(pw::is_trivially_relocatable<Point>::value);
+            REQUIRE(pw::is_trivially_relocatable_v<Point>);
+        }
+    }
+    GIVEN("An int")
+    {
+        THEN("is_trivially_relocatable_v is true")
+        {
+            REQUIRE(pw::is_trivially_relocatable_v<int>);
+        }
+    }
+    GIVEN("A class with a user provided move constructor")
+    {
+        THEN("is_trivially_relocatable_v is false")
+        {
+            REQUIRE(!pw::is_trivially_copyable_v<std::string>);
+            REQUIRE(!pw::is_trivially_relocatable_v<std::string>);
+        }
+    }
+    GIVEN("A class that opts in by specializing is_trivially_relocatable")
+    {
+        THEN("is_trivially_copyable_v is false")
+        {
+            REQUIRE(!pw::is_trivially_copyable_v<Handle>);
+        }
+        THEN("is_trivially_relocatable_v is true")
+        {
+            REQUIRE(pw::is_trivially_relocatable_v<Handle>);
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#include <pw/impl/algorithm/lexicographical_compare.h>
+#include <pw/internal/compare.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+
+SCENARIO("pw::lexicographical_compare() orders ranges", "[lexicographical_compare]")
+{
+    GIVEN("Arrays of int including negative values")
+    {
+        int a[] = { 1, -2, 3 };
+        int b[] = { 1, 2, 3 };
+        THEN("Values, not bytes, are compared")
+        {
+            REQUIRE(pw::lexicographical_compare(&a[0], &a[3], &b[0], &b[3]));
+            REQUIRE_FALSE(pw::lexicographical_compare(&b[0], &b[3], &a[0], &a[3]));
+            REQUIRE(pw::internal::compare(&a[0], &a[3], &b[0], &b[3]) == -1);
+            REQUIRE(pw::internal::compare(&b[0], &b[3], &a[0], &a[3]) == 1);
+        }
+        THEN("A prefix is less")
+        {
+            REQUIRE(pw::lexicographical_compare(&a[0], &a[2], &a[0], &a[3]));
+            REQUIRE(pw::internal::compare(&a[0], &a[2], &a[0], &a[3]) == -1);
+            REQUIRE(pw::internal::compare(&a[0], &a[3], &a[0], &a[3]) == 0);
+        }
+    }
+    GIVEN("Arrays of unsigned char")
+    {
+        unsigned char a[] = { 1, 200, 3 };
+        unsigned char b[] = { 1, 100, 3 };
+        THEN("They are compared with memcmp()")
+        {
+            REQUIRE(pw::lexicographical_compare(&b[0], &b[3], &a[0], &a[3]));
+            REQUIRE(pw::internal::compare(&a[0], &a[3], &b[0], &b[3]) == 1);
+        }
+    }
+    GIVEN("Long arrays of int that differ near the end")
+    {
+        int a[1000];
+        int b[1000];
+        for (int i = 0; i < 1000; ++i)
+        {
+            a[i] = b[i] = i - 500;
+        }
+        b[998] = -1000;
+        THEN("The first difference decides")
+        {
+            REQUIRE(pw::lexicographical_compare(&b[0], &b[1000], &a[0], &a[1000]));
+            REQUIRE(pw::internal::compare(&a[0], &a[1000], &b[0], &b[1000]) == 1);
+        }
+    }
+    GIVEN("Arrays of std::string")
+    {
+        std::string a[] = { "a", "b" };
+        std::string b[] = { "a", "c" };
+        THEN("operator< is used")
+        {
+            REQUIRE(pw::lexicographical_compare(&a[0], &a[2], &b[0], &b[2]));
+            REQUIRE(pw::internal::compare(&b[0], &b[2], &a[0], &a[2]) == 1);
+        }
+    }
+}
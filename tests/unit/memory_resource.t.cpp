@@ -0,0 +1,538 @@
+#include <pw/memory_resource>
+#include <pw/vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+/**
+ * Forwards to new_delete_resource() and counts what is outstanding
+ */
+class CountingResource : public pw::pmr::memory_resource
+{
+public:
+    int    allocations = 0;
+    pw::size_t bytes       = 0;
+
+private:
+    void* do_allocate(pw::size_t count, pw::size_t alignment) override
+    {
+        ++allocations;
+        bytes += count;
+        return pw::pmr::new_delete_resource()->allocate(count, alignment);
+    }
+    void do_deallocate(void* p, pw::size_t count, pw::size_t alignment) override
+    {
+        --allocations;
+        bytes -= count;
+        pw::pmr::new_delete_resource()->deallocate(p, count, alignment);
+    }
+    bool do_is_equal(memory_resource const& other) const noexcept override { return this == &other; }
+};
+
+/**
+ * Counts how many have been destroyed
+ */
+struct Tracked
+{
+    static inline int destroyed = 0;
+
+    explicit Tracked(int v)
+        : value(v)
+    {
+    }
+    Tracked(Tracked const& other)
+        : value(other.value)
+    {
+    }
+    ~Tracked() { ++destroyed; }
+
+    int value;
+};
+
+bool
+aligned(void* p, pw::size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+} // namespace
+
+TEST_CASE("monotonic_buffer_resource", "[pmr][monotonic_buffer_resource]")
+{
+    CountingResource upstream;
+
+    SECTION("uses the initial buffer before upstream")
+    {
+        alignas(16) unsigned char      buffer[256];
+        pw::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer), &upstream);
+
+        void* p1 = resource.allocate(16, 8);
+        void* p2 = resource.allocate(16, 8);
+        REQUIRE(p1 == buffer);
+        REQUIRE(p2 == buffer + 16);
+        REQUIRE(upstream.allocations == 0);
+
+        resource.allocate(512, 8);
+        REQUIRE(upstream.allocations == 1);
+        REQUIRE(resource.upstream_resource() == &upstream);
+    }
+    SECTION("honors alignment")
+    {
+        pw::pmr::monotonic_buffer_resource resource(&upstream);
+        resource.allocate(1, 1);
+        REQUIRE(aligned(resource.allocate(8, 8), 8));
+        resource.allocate(1, 1);
+        REQUIRE(aligned(resource.allocate(32, 64), 64));
+    }
+    SECTION("deallocate() does nothing and release() frees everything")
+    {
+        pw::pmr::monotonic_buffer_resource resource(64, &upstream);
+        for (int i = 0; i < 100; ++i)
+        {
+            void* p = resource.allocate(48, 8);
+            resource.deallocate(p, 48, 8);
+        }
+        REQUIRE(upstream.allocations > 1);
+        resource.release();
+        REQUIRE(upstream.allocations == 0);
+        REQUIRE(upstream.bytes == 0);
+    }
+    SECTION("chunks grow geometrically")
+    {
+        pw::pmr::monotonic_buffer_resource resource(64, &upstream);
+        for (int i = 0; i < 1000; ++i)
+        {
+            resource.allocate(64, 8);
+        }
+        REQUIRE(upstream.allocations < 20);
+    }
+    SECTION("a pmr::vector grows without giving memory back")
+    {
+        {
+            pw::pmr::monotonic_buffer_resource resource(&upstream);
+            pw::pmr::vector<int>               v(&resource);
+            for (int i = 0; i < 1000; ++i)
+            {
+                v.push_back(i);
+            }
+            REQUIRE(v.size() == 1000);
+            REQUIRE(v[999] == 999);
+        }
+        REQUIRE(upstream.allocations == 0);
+    }
+}
+
+TEST_CASE("arena_resource", "[pmr][arena_resource]")
+{
+    CountingResource upstream;
+
+    SECTION("arena_allocator never deallocates")
+    {
+        STATIC_REQUIRE(pw::internal::Storage<int, pw::pmr::arena_allocator<int>>::bulk_release);
+        STATIC_REQUIRE(!pw::internal::Storage<int, pw::pmr::polymorphic_allocator<int>>::bulk_release);
+
+        pw::pmr::arena_resource        arena(&upstream);
+        pw::pmr::arena_allocator<long> alloc(&arena);
+        long*                          p = alloc.allocate(4);
+        REQUIRE(aligned(p, alignof(long)));
+        REQUIRE(alloc.resource() == &arena);
+        REQUIRE(alloc == pw::pmr::arena_allocator<long>(pw::pmr::arena_allocator<char>(&arena)));
+        alloc.deallocate(p, 4);
+    }
+    SECTION("many vectors share a few chunks that go away with the arena")
+    {
+        {
+            pw::pmr::arena_resource arena(&upstream);
+            for (int n = 0; n < 1000; ++n)
+            {
+                pw::pmr::arena_vector<int> v(&arena);
+                for (int i = 0; i < 10; ++i)
+                {
+                    v.push_back(i);
+                }
+                REQUIRE(v[9] == 9);
+            }
+            REQUIRE(upstream.allocations > 0);
+            REQUIRE(upstream.allocations < 20);
+        }
+        REQUIRE(upstream.allocations == 0);
+        REQUIRE(upstream.bytes == 0);
+    }
+    SECTION("elements with destructors are still destroyed")
+    {
+        pw::pmr::arena_resource arena(&upstream);
+        Tracked::destroyed = 0;
+        {
+            pw::pmr::arena_vector<Tracked> v(&arena);
+            v.emplace_back(1);
+            v.emplace_back(2);
+            v.reserve(100);
+            Tracked::destroyed = 0;
+        }
+        REQUIRE(Tracked::destroyed == 2);
+    }
+    SECTION("copies and moves stay in the arena")
+    {
+        pw::pmr::arena_resource          arena(&upstream);
+        pw::pmr::arena_vector<int>       v1({ 1, 2, 3 }, &arena);
+        pw::pmr::arena_vector<int>       v2(v1);
+        pw::pmr::arena_vector<int> const v3(pw::move(v1));
+        REQUIRE(v2 == v3);
+        REQUIRE(v2.get_allocator().resource() == &arena);
+        REQUIRE(v1.empty());
+    }
+}
+
+TEST_CASE("unsynchronized_pool_resource", "[pmr][pool_resource]")
+{
+    CountingResource upstream;
+
+    SECTION("options() has the defaults filled in")
+    {
+        pw::pmr::unsynchronized_pool_resource resource(&upstream);
+        REQUIRE(resource.options().max_blocks_per_chunk > 0);
+        REQUIRE(resource.options().largest_required_pool_block >= 4096);
+        REQUIRE(resource.upstream_resource() == &upstream);
+    }
+    SECTION("a freed block is reused by the next request of the same size class")
+    {
+        pw::pmr::unsynchronized_pool_resource resource(&upstream);
+        void*                                 p1 = resource.allocate(40, 8);
+        REQUIRE(aligned(p1, 16));
+        resource.deallocate(p1, 40, 8);
+        int const before = upstream.allocations;
+        void*     p2     = resource.allocate(48, 8);
+        REQUIRE(p2 == p1);
+        REQUIRE(upstream.allocations == before);
+    }
+    SECTION("blocks of one size come from a shared chunk")
+    {
+        pw::pmr::unsynchronized_pool_resource resource(&upstream);
+        resource.allocate(32, 8);
+        int const before = upstream.allocations;
+        for (int i = 0; i < 20; ++i)
+        {
+            resource.allocate(32, 8);
+        }
+        REQUIRE(upstream.allocations == before);
+    }
+    SECTION("large and over-aligned requests go upstream")
+    {
+        pw::pmr::unsynchronized_pool_resource resource({ 0, 256 }, &upstream);
+        int const                             before = upstream.allocations;
+        void*                                 large  = resource.allocate(1000, 8);
+        void*                                 wide   = resource.allocate(64, 64);
+        REQUIRE(upstream.allocations == before + 2);
+        REQUIRE(aligned(wide, 64));
+        resource.deallocate(large, 1000, 8);
+        resource.deallocate(wide, 64, 64);
+        REQUIRE(upstream.allocations == before);
+    }
+    SECTION("release() and the destructor give everything back")
+    {
+        {
+            pw::pmr::unsynchronized_pool_resource resource(&upstream);
+            for (pw::size_t size = 1; size < 10000; size *= 3)
+            {
+                resource.allocate(size, 8);
+            }
+            resource.release();
+            resource.allocate(16, 8);
+            resource.allocate(20000, 8);
+        }
+        REQUIRE(upstream.allocations == 0);
+        REQUIRE(upstream.bytes == 0);
+    }
+    SECTION("a pmr::vector reuses blocks as it grows")
+    {
+        pw::pmr::unsynchronized_pool_resource resource(&upstream);
+        pw::pmr::vector<int>                  v(&resource);
+        for (int i = 0; i < 1000; ++i)
+        {
+            v.push_back(i);
+        }
+        REQUIRE(v[500] == 500);
+    }
+}
+
+TEST_CASE("synchronized_pool_resource", "[pmr][pool_resource]")
+{
+    CountingResource upstream;
+    {
+        pw::pmr::synchronized_pool_resource resource(&upstream);
+        std::vector<std::thread>            threads;
+        for (int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&resource] {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    pw::size_t const size = 8 + (i % 64) * 8;
+                    void*        p    = resource.allocate(size, 8);
+                    resource.deallocate(p, size, 8);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    REQUIRE(upstream.allocations == 0);
+}
+
+TEST_CASE("default resource", "[pmr][default_resource]")
+{
+    CountingResource resource;
+
+    REQUIRE(pw::pmr::get_default_resource() == pw::pmr::new_delete_resource());
+    REQUIRE(pw::pmr::set_default_resource(&resource) == pw::pmr::new_delete_resource());
+    REQUIRE(pw::pmr::get_default_resource() == &resource);
+    {
+        pw::pmr::vector<int> v { 1, 2, 3 };
+        REQUIRE(resource.allocations == 1);
+    }
+    REQUIRE(pw::pmr::set_default_resource(nullptr) == &resource);
+    REQUIRE(pw::pmr::get_default_resource() == pw::pmr::new_delete_resource());
+}
+
+TEST_CASE("thread_caching_resource", "[pmr][thread_caching_resource]")
+{
+    CountingResource upstream;
+
+    SECTION("a freed block is reused by the same thread")
+    {
+        pw::pmr::thread_caching_resource resource(&upstream);
+        REQUIRE(resource.upstream_resource() == &upstream);
+
+        void* p1 = resource.allocate(40, 8);
+        REQUIRE(aligned(p1, 16));
+        resource.deallocate(p1, 40, 8);
+        int const before = upstream.allocations;
+        void*     p2     = resource.allocate(48, 8);
+        REQUIRE(p2 == p1);
+        REQUIRE(upstream.allocations == before);
+        resource.deallocate(p2, 48, 8);
+    }
+    SECTION("large and over-aligned requests go upstream")
+    {
+        pw::pmr::thread_caching_resource resource(&upstream);
+        void*                            large = resource.allocate(10000, 8);
+        void*                            wide  = resource.allocate(64, 64);
+        REQUIRE(aligned(wide, 64));
+        resource.deallocate(large, 10000, 8);
+        resource.deallocate(wide, 64, 64);
+        int const before = upstream.allocations;
+        large            = resource.allocate(10000, 8);
+        REQUIRE(upstream.allocations == before + 1);
+        resource.deallocate(large, 10000, 8);
+    }
+    SECTION("the destructor gives everything back")
+    {
+        {
+            pw::pmr::thread_caching_resource resource(&upstream);
+            pw::pmr::vector<int>             v(&resource);
+            for (int i = 0; i < 1000; ++i)
+            {
+                v.push_back(i);
+            }
+            REQUIRE(v[999] == 999);
+        }
+        REQUIRE(upstream.allocations == 0);
+        REQUIRE(upstream.bytes == 0);
+    }
+    SECTION("threads free blocks allocated by other threads")
+    {
+        {
+            pw::pmr::synchronized_pool_resource locked(&upstream);
+            pw::pmr::thread_caching_resource    resource(&locked);
+            std::vector<void*>               blocks;
+            for (int i = 0; i < 100; ++i)
+            {
+                blocks.push_back(resource.allocate(32, 8));
+            }
+            std::vector<std::thread> threads;
+            for (int t = 0; t < 4; ++t)
+            {
+                threads.emplace_back([&resource, &blocks, t] {
+                    for (int i = t; i < 100; i += 4)
+                    {
+                        resource.deallocate(blocks[i], 32, 8);
+                    }
+                    for (int i = 0; i < 1000; ++i)
+                    {
+                        pw::pmr::vector<int> v({ 1, 2, 3, i }, &resource);
+                        v.push_back(i);
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+        REQUIRE(upstream.allocations == 0);
+    }
+}
+
+TEST_CASE("stats_resource", "[pmr][stats_resource]")
+{
+    CountingResource upstream;
+
+    SECTION("counts allocations, bytes in use and the peak")
+    {
+        pw::pmr::stats_resource resource(&upstream);
+        REQUIRE(resource.upstream_resource() == &upstream);
+
+        void* p1 = resource.allocate(100, 8);
+        void* p2 = resource.allocate(5000, 64);
+        REQUIRE(aligned(p1, 8));
+        REQUIRE(aligned(p2, 64));
+        resource.deallocate(p1, 100, 8);
+
+        pw::pmr::stats_snapshot const stats = resource.snapshot();
+        REQUIRE(stats.allocations == 2);
+        REQUIRE(stats.deallocations == 1);
+        REQUIRE(stats.bytes_allocated == 5100);
+        REQUIRE(stats.bytes_in_use == 5000);
+        REQUIRE(stats.peak_bytes_in_use == 5100);
+        REQUIRE(stats.size_classes[pw::pmr::stats_snapshot::size_class_bucket(112)] == 1);
+        REQUIRE(stats.size_classes[pw::pmr::stats_snapshot::size_class_count - 1] == 1);
+        REQUIRE(stats.lifetimes[0] + stats.lifetimes[1] + stats.lifetimes[2] + stats.lifetimes[3] == 1);
+        REQUIRE(stats.seconds > 0);
+        REQUIRE(stats.allocation_rate() > 0);
+
+        resource.deallocate(p2, 5000, 64);
+        REQUIRE(resource.snapshot().bytes_in_use == 0);
+        REQUIRE(upstream.allocations == 0);
+    }
+    SECTION("lifetimes fall into decades")
+    {
+        REQUIRE(pw::pmr::stats_snapshot::lifetime_bucket(0) == 0);
+        REQUIRE(pw::pmr::stats_snapshot::lifetime_bucket(999) == 0);
+        REQUIRE(pw::pmr::stats_snapshot::lifetime_bucket(1000) == 1);
+        REQUIRE(pw::pmr::stats_snapshot::lifetime_bucket(2'000'000'000) == 7);
+        REQUIRE(pw::pmr::stats_snapshot::lifetime_bucket(~0ull) ==
+                pw::pmr::stats_snapshot::lifetime_bucket_count - 1);
+    }
+    SECTION("a pmr::vector is attributed to its resource from several threads")
+    {
+        // CountingResource isn't thread safe
+        pw::pmr::stats_resource  resource(pw::pmr::new_delete_resource());
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&resource] {
+                for (int i = 0; i < 100; ++i)
+                {
+                    pw::pmr::vector<int> v({ 1, 2, 3 }, &resource);
+                    v.push_back(i);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        pw::pmr::stats_snapshot const stats = resource.snapshot();
+        REQUIRE(stats.allocations == stats.deallocations);
+        REQUIRE(stats.allocations >= 400);
+        REQUIRE(stats.bytes_in_use == 0);
+        REQUIRE(stats.peak_bytes_in_use > 0);
+    }
+    SECTION("to_prometheus()")
+    {
+        pw::pmr::stats_resource resource(&upstream);
+        resource.deallocate(resource.allocate(24, 8), 24, 8);
+
+        std::string const text = resource.snapshot().to_prometheus("parser_memory");
+        REQUIRE(text.find("# TYPE parser_memory_allocations_total counter\n"
+                          "parser_memory_allocations_total 1\n") != std::string::npos);
+        REQUIRE(text.find("parser_memory_bytes_in_use 0\n") != std::string::npos);
+        REQUIRE(text.find("parser_memory_allocation_size_bytes_bucket{le=\"16\"} 0\n") != std::string::npos);
+        REQUIRE(text.find("parser_memory_allocation_size_bytes_bucket{le=\"32\"} 1\n") != std::string::npos);
+        REQUIRE(text.find("parser_memory_allocation_size_bytes_bucket{le=\"+Inf\"} 1\n") !=
+                std::string::npos);
+        REQUIRE(text.find("parser_memory_allocation_size_bytes_sum 24\n") != std::string::npos);
+        REQUIRE(text.find("parser_memory_lifetime_seconds_bucket{le=\"+Inf\"} 1\n") != std::string::npos);
+        REQUIRE(text.find("parser_memory_lifetime_seconds_count 1\n") != std::string::npos);
+    }
+}
+
+TEST_CASE("mmap_resource", "[pmr][mmap_resource]")
+{
+    CountingResource upstream;
+    pw::size_t const huge = 2 * 1024 * 1024;
+
+    SECTION("small requests go upstream")
+    {
+        pw::pmr::mmap_resource resource({}, &upstream);
+        REQUIRE(resource.upstream_resource() == &upstream);
+        REQUIRE(resource.options().threshold == 1024 * 1024);
+
+        void* p = resource.allocate(1000, 8);
+        REQUIRE(upstream.allocations == 1);
+        resource.deallocate(p, 1000, 8);
+        REQUIRE(upstream.allocations == 0);
+    }
+    SECTION("large requests are mapped on a huge page boundary")
+    {
+        pw::pmr::mmap_resource resource({}, &upstream);
+
+        pw::size_t const bytes = 3 * huge + 100;
+        auto*            p     = static_cast<unsigned char*>(resource.allocate(bytes, 64));
+        REQUIRE(upstream.allocations == 0);
+        REQUIRE(aligned(p, huge));
+        p[0]         = 1;
+        p[bytes - 1] = 2;
+        REQUIRE(p[0] + p[bytes - 1] == 3);
+        resource.deallocate(p, bytes, 64);
+    }
+    SECTION("over-aligned requests go upstream")
+    {
+        pw::pmr::mmap_resource resource({ .threshold = 4096 }, &upstream);
+
+        void* p = resource.allocate(8192, 8192);
+        REQUIRE(upstream.allocations == 1);
+        REQUIRE(aligned(p, 8192));
+        resource.deallocate(p, 8192, 8192);
+    }
+    SECTION("reserved huge pages, ordinary pages and NUMA placement fall back quietly")
+    {
+        for (auto pages : { pw::pmr::huge_pages::none, pw::pmr::huge_pages::reserved })
+        {
+            for (auto placement : { pw::pmr::numa_placement::bind, pw::pmr::numa_placement::interleave })
+            {
+                pw::pmr::mmap_resource resource({ .threshold  = 4096,
+                                                  .pages      = pages,
+                                                  .placement  = placement,
+                                                  .numa_nodes = 1 },
+                                                &upstream);
+                auto* p = static_cast<int*>(resource.allocate(100'000, alignof(int)));
+                REQUIRE(aligned(p, 4096));
+                p[0]                         = 7;
+                p[100'000 / sizeof(int) - 1] = 8;
+                REQUIRE(p[0] == 7);
+                resource.deallocate(p, 100'000, alignof(int));
+            }
+        }
+        REQUIRE(upstream.allocations == 0);
+    }
+    SECTION("pmr::vector")
+    {
+        pw::pmr::mmap_resource resource({ .threshold = 64 * 1024 }, &upstream);
+        {
+            pw::pmr::vector<int> values(&resource);
+            for (int value = 0; value < 100'000; ++value)
+            {
+                values.push_back(value);
+            }
+            REQUIRE(values[99'999] == 99'999);
+            REQUIRE(aligned(values.data(), huge));
+        }
+        REQUIRE(upstream.allocations == 0);
+    }
+}
@@ -0,0 +1,44 @@
+#include <pw/impl/algorithm/rotate.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <list>
+#include <string>
+
+SCENARIO("rotate", "[rotate]")
+{
+    GIVEN("An array of int")
+    {
+        for (int size = 0; size < 8; ++size)
+        {
+            for (int middle = 0; middle <= size; ++middle)
+            {
+                int actual[8];
+                int expected[8];
+                for (int i = 0; i < size; ++i)
+                {
+                    actual[i] = expected[i] = i;
+                }
+                int* result = pw::rotate(&actual[0], &actual[middle], &actual[size]);
+                std::rotate(&expected[0], &expected[middle], &expected[size]);
+                INFO("size: " << size << " middle: " << middle);
+                REQUIRE(std::equal(&actual[0], &actual[size], &expected[0]));
+                REQUIRE(result == &actual[size - middle]);
+            }
+        }
+    }
+    GIVEN("A list of std::string")
+    {
+        std::list<std::string> values { "a", "b", "c", "d", "e" };
+        WHEN("rotated so the third element is first")
+        {
+            auto result = pw::rotate(values.begin(), std::next(values.begin(), 2), values.end());
+            THEN("the elements wrap around")
+            {
+                REQUIRE(values == std::list<std::string> { "c", "d", "e", "a", "b" });
+                REQUIRE(*result == "a");
+            }
+        }
+    }
+}
@@ -0,0 +1,287 @@
+#include <pw/memory_resource>
+#include <pw/small_vector>
+
+#include <test_throwing_allocator.h>
+#include <test_throwingtype.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+/**
+ * Counts the objects it constructs and destroys
+ */
+template<class Type>
+struct LifetimeAllocator
+{
+    using value_type = Type;
+
+    static inline int constructed = 0;
+    static inline int destroyed   = 0;
+
+    LifetimeAllocator() = default;
+    template<class Other>
+    LifetimeAllocator(LifetimeAllocator<Other> const&)
+    {
+    }
+
+    Type* allocate(std::size_t count) { return static_cast<Type*>(::operator new(count * sizeof(Type))); }
+    void  deallocate(Type* ptr, std::size_t) { ::operator delete(ptr); }
+
+    template<class... Args>
+    void construct(Type* ptr, Args&&... args)
+    {
+        ::new (static_cast<void*>(ptr)) Type(std::forward<Args>(args)...);
+        ++constructed;
+    }
+    void destroy(Type* ptr)
+    {
+        ptr->~Type();
+        ++destroyed;
+    }
+
+    friend bool operator==(LifetimeAllocator const&, LifetimeAllocator const&) { return true; }
+};
+} // namespace
+
+TEST_CASE("small_vector keeps elements inline", "[small_vector]")
+{
+    using Vector = pw::small_vector<std::string, 4>;
+
+    GIVEN("An empty small_vector")
+    {
+        Vector v;
+        THEN("it uses the inline buffer")
+        {
+            REQUIRE(v.empty());
+            REQUIRE(v.capacity() == Vector::inline_capacity);
+            REQUIRE(v.is_inline());
+        }
+        WHEN("push_back() up to the inline capacity")
+        {
+            v.push_back("a");
+            v.push_back("b");
+            v.push_back("c");
+            v.push_back("d");
+            THEN("it is still inline")
+            {
+                REQUIRE(v.is_inline());
+                REQUIRE(v.size() == 4);
+                REQUIRE(v.front() == "a");
+                REQUIRE(v.back() == "d");
+            }
+            AND_WHEN("push_back() one more")
+            {
+                v.push_back("e");
+                THEN("it moves to the allocator")
+                {
+                    REQUIRE(!v.is_inline());
+                    REQUIRE(v.capacity() > Vector::inline_capacity);
+                    REQUIRE(v.size() == 5);
+                    REQUIRE(v[0] == "a");
+                    REQUIRE(v[4] == "e");
+                }
+                AND_WHEN("it shrinks and shrink_to_fit() is called")
+                {
+                    v.pop_back();
+                    v.pop_back();
+                    v.shrink_to_fit();
+                    THEN("it is inline again")
+                    {
+                        REQUIRE(v.is_inline());
+                        REQUIRE(v.size() == 3);
+                        REQUIRE(v.back() == "c");
+                    }
+                }
+            }
+        }
+    }
+    GIVEN("A small_vector constructed with more than the inline capacity")
+    {
+        Vector v { "a", "b", "c", "d", "e", "f" };
+        THEN("it is not inline")
+        {
+            REQUIRE(!v.is_inline());
+            REQUIRE(v.size() == 6);
+        }
+    }
+}
+
+TEST_CASE("small_vector copy, move and swap", "[small_vector][swap]")
+{
+    using Vector = pw::small_vector<std::string, 2>;
+
+    Vector small { "a", "b" };
+    Vector large { "1", "2", "3" };
+
+    REQUIRE(small.is_inline());
+    REQUIRE(!large.is_inline());
+
+    SECTION("copy of an inline small_vector")
+    {
+        Vector copy(small);
+        REQUIRE(copy.is_inline());
+        REQUIRE(copy == small);
+    }
+    SECTION("move of an inline small_vector moves the elements")
+    {
+        Vector moved(pw::move(small));
+        REQUIRE(moved.is_inline());
+        REQUIRE(moved.size() == 2);
+        REQUIRE(moved[1] == "b");
+        REQUIRE(small.empty());
+    }
+    SECTION("move of a large small_vector takes its memory")
+    {
+        auto const* data = large.data();
+        Vector      moved(pw::move(large));
+        REQUIRE(moved.data() == data);
+        REQUIRE(moved.size() == 3);
+        REQUIRE(large.empty());
+    }
+    SECTION("move assignment from a large small_vector takes its memory")
+    {
+        auto const* data = large.data();
+        small            = pw::move(large);
+        REQUIRE(small.data() == data);
+        REQUIRE(small.size() == 3);
+        REQUIRE(small[2] == "3");
+    }
+    SECTION("move assignment from an inline small_vector moves the elements")
+    {
+        large = pw::move(small);
+        REQUIRE(large.size() == 2);
+        REQUIRE(large[0] == "a");
+    }
+    SECTION("swap() an inline and a large small_vector")
+    {
+        pw::swap(small, large);
+        REQUIRE(small.size() == 3);
+        REQUIRE(small[2] == "3");
+        REQUIRE(!small.is_inline());
+        REQUIRE(large.size() == 2);
+        REQUIRE(large[1] == "b");
+        REQUIRE(large.is_inline());
+    }
+    SECTION("swap() two large small_vectors swaps memory")
+    {
+        Vector      other { "x", "y", "z", "w" };
+        auto const* data = other.data();
+        large.swap(other);
+        REQUIRE(large.data() == data);
+        REQUIRE(large.size() == 4);
+        REQUIRE(other.size() == 3);
+    }
+}
+
+TEST_CASE("small_vector only takes memory from an equal allocator", "[small_vector][swap]")
+{
+    using Allocator = pw::pmr::polymorphic_allocator<int>;
+    using Vector    = pw::small_vector<int, 2, Allocator>;
+
+    pw::pmr::stats_resource resource1;
+    pw::pmr::stats_resource resource2;
+
+    SECTION("move assignment")
+    {
+        {
+            Vector      vec1({ 1, 2, 3 }, Allocator(&resource1));
+            Vector      vec2({ 4, 5, 6, 7 }, Allocator(&resource2));
+            auto const* data = vec2.data();
+            vec1             = pw::move(vec2);
+            REQUIRE(vec1.data() != data);
+            REQUIRE(vec1.size() == 4);
+            REQUIRE(vec1[3] == 7);
+            REQUIRE(vec1.get_allocator() == Allocator(&resource1));
+            REQUIRE(vec2.empty());
+        }
+        REQUIRE(resource1.snapshot().bytes_in_use == 0);
+        REQUIRE(resource2.snapshot().bytes_in_use == 0);
+    }
+    SECTION("swap()")
+    {
+        {
+            Vector vec1({ 1, 2, 3 }, Allocator(&resource1));
+            Vector vec2({ 4, 5, 6, 7 }, Allocator(&resource2));
+            vec1.swap(vec2);
+            REQUIRE(vec1.size() == 4);
+            REQUIRE(vec1[0] == 4);
+            REQUIRE(vec2.size() == 3);
+            REQUIRE(vec2[2] == 3);
+            REQUIRE(vec1.get_allocator() == Allocator(&resource1));
+            REQUIRE(vec2.get_allocator() == Allocator(&resource2));
+        }
+        REQUIRE(resource1.snapshot().bytes_in_use == 0);
+        REQUIRE(resource2.snapshot().bytes_in_use == 0);
+    }
+}
+
+TEST_CASE("small_vector forwards construct() and destroy() to its allocator", "[small_vector]")
+{
+    using Allocator = LifetimeAllocator<int>;
+
+    Allocator::constructed = 0;
+    Allocator::destroyed   = 0;
+
+    SECTION("InlineAllocator forwards both")
+    {
+        pw::internal::InlineAllocator<int, 2, Allocator> alloc(Allocator(), nullptr);
+        int                                              value = 0;
+        alloc.construct(&value, 5);
+        REQUIRE(value == 5);
+        REQUIRE(Allocator::constructed == 1);
+        alloc.destroy(&value);
+        REQUIRE(Allocator::destroyed == 1);
+    }
+    SECTION("elements are destroyed through the allocator")
+    {
+        {
+            pw::small_vector<int, 2, Allocator> v;
+            v.push_back(1);
+            v.push_back(2);
+            v.pop_back();
+            REQUIRE(Allocator::destroyed == 1);
+            v.push_back(3);
+            v.push_back(4);
+            REQUIRE_FALSE(v.is_inline());
+        }
+        REQUIRE(Allocator::destroyed == 4);
+    }
+}
+
+TEST_CASE("small_vector exception safety", "[small_vector][exception_safety]")
+{
+    using value_type     = pw::test::ThrowingType;
+    using allocator_type = pw::test::ThrowingAllocator<value_type>;
+    using Vector         = pw::small_vector<value_type, 4, allocator_type>;
+
+    allocator_type::reset();
+    value_type::reset();
+
+    SECTION("Inline construction doesn't use the allocator")
+    {
+        allocator_type::should_throw_on_allocate = true;
+        Vector v(3, allocator_type());
+        REQUIRE(v.size() == 3);
+        REQUIRE(v.is_inline());
+    }
+    SECTION("Element construction failure in the inline buffer")
+    {
+        value_type::throw_after_n = 2;
+        REQUIRE_THROWS_AS(Vector(3, allocator_type()), std::runtime_error);
+        REQUIRE(value_type::construction_count == 0);
+    }
+    SECTION("Allocation failure when leaving the inline buffer")
+    {
+        Vector v(4, allocator_type());
+        allocator_type::should_throw_on_allocate = true;
+        REQUIRE_THROWS_AS(v.push_back(value_type(5)), std::bad_alloc);
+        REQUIRE(v.size() == 4);
+        REQUIRE(v.is_inline());
+        REQUIRE(value_type::construction_count == 4);
+    }
+}
@@ -9,6 +9,38 @@
 #include <catch2/catch_test_macros.hpp>
 using namespace pw::test;
 
+namespace {
+/**
+ * Counts moves and destructions but is declared trivially relocatable
+ * so Storage::relocate() should do neither.
+ */
+struct Relocatable
+{
+    static int moves;
+    static int destroys;
+
+    explicit Relocatable(int v)
+        : value(v)
+    {
+    }
+    Relocatable(Relocatable&& other) noexcept
+        : value(other.value)
+    {
+        ++moves;
+    }
+    ~Relocatable() { ++destroys; }
+
+    int value;
+};
+int Relocatable::moves    = 0;
+int Relocatable::destroys = 0;
+} // namespace
+
+template<>
+struct pw::is_trivially_relocatable<Relocatable> : pw::true_type
+{
+};
+
 SCENARIO("Storage constructor sets up capacity", "[storage]")
 {
     GIVEN("A Storage instance with capacity memory")
@@ -20,10 +52,10 @@ SCENARIO("Storage constructor sets up capacity", "[storage]")
             REQUIRE(storage.empty());
             THEN("the capacity size is correct")
             {
-                REQUIRE(storage.capacity() == 5);
+                REQUIRE(storage.capacity() >= 5);
                 REQUIRE(storage.end() == storage.begin());
                 REQUIRE(storage.capacity_begin() == storage.begin());
-                REQUIRE(storage.capacity_end() == storage.begin() + 5);
+                REQUIRE(storage.capacity_end() == storage.begin() + storage.capacity());
             }
         }
         WHEN("This size is 1")
@@ -33,7 +65,7 @@ SCENARIO("Storage constructor sets up capacity", "[storage]")
             THEN("the capacity size is correct")
             {
                 REQUIRE(storage.capacity_begin() == storage.begin() + 1);
-                REQUIRE(storage.capacity_end() == storage.begin() + 5);
+                REQUIRE(storage.capacity_end() == storage.begin() + storage.capacity());
             }
         }
     }
@@ -236,6 +268,49 @@ SCENARIO("Storage::uninitialized_move() provides exception safety", "[storage]")
     }
 }
 
+SCENARIO("Storage constructs trivially copyable elements a block at a time", "[storage][bitwise]")
+{
+    using Doubles = pw::internal::Storage<double>;
+    STATIC_REQUIRE(Doubles::bitwise_construct);
+    STATIC_REQUIRE_FALSE(pw::internal::Storage<ThrowingType>::bitwise_construct);
+
+    GIVEN("A Storage of double whose memory isn't zero")
+    {
+        constexpr size_t count = 1000;
+        Doubles          storage(pw::allocator<double> {}, count);
+        __builtin_memset(static_cast<void*>(storage.begin()), 0xff, count * sizeof(double));
+
+        WHEN("The elements are value initialized")
+        {
+            storage.uninitialized_default_construct(storage.begin(), storage.begin() + count).set_size(count);
+            THEN("every element is zero")
+            {
+                size_t zeros = 0;
+                for (double value : storage)
+                {
+                    zeros += value == 0.0;
+                }
+                REQUIRE(zeros == count);
+            }
+            AND_WHEN("They are filled and then copied and moved into other Storage")
+            {
+                storage.uninitialized_fill(storage.begin(), storage.end(), 1.5);
+                Doubles copy(pw::allocator<double> {}, count);
+                Doubles moved(pw::allocator<double> {}, count);
+                copy.uninitialized_copy(storage.begin(), storage.end(), copy.begin()).set_size(count);
+                moved.uninitialized_move(storage.begin(), storage.end(), moved.begin()).set_size(count);
+                THEN("every element has the value")
+                {
+                    REQUIRE(copy.begin()[0] == 1.5);
+                    REQUIRE(copy.begin()[count - 1] == 1.5);
+                    REQUIRE(moved.begin()[0] == 1.5);
+                    REQUIRE(moved.begin()[count - 1] == 1.5);
+                }
+            }
+        }
+    }
+}
+
 SCENARIO("Storage::copy() copies objects to initialized memory", "[storage]")
 {
     GIVEN("Source data and initialized target Storage")
@@ -317,4 +392,176 @@ SCENARIO("Storage member functions work with OpTracker for operation counting",
             }
         }
     }
-}
\ No newline at end of file
+}
+SCENARIO("Storage allocates at least the requested capacity", "[storage][allocate_at_least]")
+{
+    GIVEN("A Storage of int for 5 elements")
+    {
+        pw::internal::Storage<int> storage(pw::allocator<int> {}, 5);
+        THEN("capacity() is the malloc size class")
+        {
+            REQUIRE(storage.capacity() == 8);
+        }
+        WHEN("reset_to() is called")
+        {
+            storage.reset_to(33);
+            THEN("capacity() is rounded up as well")
+            {
+                REQUIRE(storage.capacity() == 40);
+            }
+        }
+    }
+    GIVEN("A Storage of int for exactly 5 elements")
+    {
+        pw::internal::Storage<int> storage(pw::allocator<int> {}, 5, false);
+        THEN("capacity() is 5")
+        {
+            REQUIRE(storage.capacity() == 5);
+        }
+    }
+}
+
+SCENARIO("Storage::relocate() moves a range into uninitialized memory", "[storage][relocate]")
+{
+    GIVEN("A Storage of int")
+    {
+        pw::internal::Storage<int> storage(pw::allocator<int> {}, 6);
+        int const                  source[] = { 1, 2, 3 };
+        storage.uninitialized_copy(source, source + 3, storage.begin()).set_size(3);
+
+        WHEN("relocate() shifts the elements up by two")
+        {
+            REQUIRE(pw::internal::Storage<int>::trivially_relocatable);
+            storage.relocate(storage.begin(), storage.begin() + 3, storage.begin() + 2);
+
+            THEN("the overlapping ranges are handled")
+            {
+                REQUIRE(storage.begin()[2] == 1);
+                REQUIRE(storage.begin()[3] == 2);
+                REQUIRE(storage.begin()[4] == 3);
+            }
+        }
+    }
+}
+
+SCENARIO("Storage::relocate() takes over another Storage", "[storage][relocate]")
+{
+    GIVEN("A Storage of trivially relocatable elements")
+    {
+        using Storage = pw::internal::Storage<Relocatable>;
+
+        REQUIRE(Storage::trivially_relocatable);
+        Storage source(pw::allocator<Relocatable> {}, 3);
+        source.construct(source.begin(), 1);
+        source.construct(source.begin() + 1, 2);
+        source.construct(source.begin() + 2, 3);
+        source.set_size(3);
+        Relocatable::moves    = 0;
+        Relocatable::destroys = 0;
+
+        WHEN("relocate() leaves a gap for one element at index 1")
+        {
+            Storage target(pw::allocator<Relocatable> {}, 4);
+            target.construct(target.begin() + 1, 42);
+            target.relocate(source, 1, 1);
+
+            THEN("no move constructor or destructor is called")
+            {
+                REQUIRE(Relocatable::moves == 0);
+                REQUIRE(Relocatable::destroys == 0);
+            }
+            THEN("the elements are in order around the gap")
+            {
+                REQUIRE(target.size() == 4);
+                REQUIRE(target.begin()[0].value == 1);
+                REQUIRE(target.begin()[1].value == 42);
+                REQUIRE(target.begin()[2].value == 2);
+                REQUIRE(target.begin()[3].value == 3);
+            }
+            THEN("the source is empty")
+            {
+                REQUIRE(source.empty());
+                REQUIRE(source.capacity() >= 3);
+            }
+        }
+    }
+    GIVEN("A Storage of ThrowingType which is not trivially relocatable")
+    {
+        using Storage = pw::internal::Storage<ThrowingType>;
+
+        REQUIRE(!Storage::trivially_relocatable);
+        ThrowingType::reset();
+        Storage source(pw::allocator<ThrowingType> {}, 4);
+        source.uninitialized_default_construct(source.begin(), source.begin() + 4).set_size(4);
+
+        WHEN("relocate() succeeds")
+        {
+            Storage target(pw::allocator<ThrowingType> {}, 5);
+            target.construct(target.begin() + 4, 7);
+            target.relocate(source, 4, 1);
+
+            THEN("the source elements are destroyed")
+            {
+                REQUIRE(source.empty());
+                REQUIRE(target.size() == 5);
+                REQUIRE(ThrowingType::construction_count == 5);
+            }
+        }
+        WHEN("a move constructor throws")
+        {
+            Storage target(pw::allocator<ThrowingType> {}, 5);
+            target.construct(target.begin() + 2, 7);
+            ThrowingType::throw_after_n = 7;
+
+            REQUIRE_THROWS(target.relocate(source, 2, 1));
+
+            THEN("the gap and relocated elements are destroyed and the source is unchanged")
+            {
+                REQUIRE(target.empty());
+                REQUIRE(source.size() == 4);
+                REQUIRE(ThrowingType::construction_count == 4);
+            }
+        }
+    }
+}
+
+SCENARIO("Storage::try_expand() grows capacity in place", "[storage][try_expand]")
+{
+    GIVEN("A Storage of int with elements")
+    {
+        pw::internal::Storage<int> storage(pw::allocator<int> {}, 3);
+        int const                  source[] = { 1, 2, 3 };
+        auto const                 capacity = storage.capacity();
+        storage.uninitialized_copy(source, source + 3, storage.begin()).set_size(3);
+
+        WHEN("try_expand() is called")
+        {
+            REQUIRE(storage.try_expand(100));
+            THEN("capacity is increased and the elements are kept")
+            {
+                REQUIRE(storage.capacity() == 100);
+                REQUIRE(storage.size() == 3);
+                REQUIRE(storage.begin()[0] == 1);
+                REQUIRE(storage.begin()[2] == 3);
+            }
+        }
+        WHEN("try_expand() is asked to keep one of the elements valid")
+        {
+            THEN("nothing is done")
+            {
+                REQUIRE(!storage.try_expand(100, storage.begin() + 1));
+                REQUIRE(storage.capacity() == capacity);
+            }
+        }
+    }
+    GIVEN("A Storage of a type that is not trivially relocatable")
+    {
+        pw::internal::Storage<ThrowingType> storage(pw::allocator<ThrowingType> {}, 3);
+        auto const                          capacity = storage.capacity();
+        THEN("try_expand() does nothing")
+        {
+            REQUIRE(!storage.try_expand(100));
+            REQUIRE(storage.capacity() == capacity);
+        }
+    }
+}
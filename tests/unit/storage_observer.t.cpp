@@ -0,0 +1,246 @@
+#include <pw/vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+namespace {
+using Ring = pw::storage_event_ring<8>;
+using Kind = pw::storage_event::kind;
+
+/**
+ * Hands out exactly what is asked for and reports to Observer
+ */
+template<class Type, class Observer>
+struct ObservedAllocator
+{
+    using value_type       = Type;
+    using storage_observer = Observer;
+
+    ObservedAllocator() = default;
+    template<class Other>
+    ObservedAllocator(ObservedAllocator<Other, Observer> const&)
+    {
+    }
+
+    Type* allocate(size_t count) { return static_cast<Type*>(::operator new(count * sizeof(Type))); }
+    void  deallocate(Type* ptr, size_t) { ::operator delete(ptr); }
+
+    friend bool operator==(ObservedAllocator const&, ObservedAllocator const&) { return true; }
+};
+
+/**
+ * Has room for Slack elements in every allocation so try_expand()
+ * grows in place up to Slack and moves the elements beyond it.
+ */
+template<class Type, class Observer>
+struct ExpandingAllocator
+{
+    using value_type       = Type;
+    using size_type        = size_t;
+    using storage_observer = Observer;
+
+    static constexpr size_type Slack = 4;
+
+    ExpandingAllocator() = default;
+    template<class Other>
+    ExpandingAllocator(ExpandingAllocator<Other, Observer> const&)
+    {
+    }
+
+    Type* allocate(size_type count)
+    {
+        return static_cast<Type*>(std::malloc((count < Slack ? Slack : count) * sizeof(Type)));
+    }
+    void  deallocate(Type* ptr, size_type) { std::free(ptr); }
+    Type* try_expand(Type* ptr, size_type count, size_type new_count)
+    {
+        if (new_count <= Slack)
+        {
+            return ptr;
+        }
+        Type* const moved = allocate(new_count);
+        std::memcpy(moved, ptr, count * sizeof(Type));
+        deallocate(ptr, count);
+        return moved;
+    }
+
+    friend bool operator==(ExpandingAllocator const&, ExpandingAllocator const&) { return true; }
+};
+
+/**
+ * A user supplied sink that keeps everything
+ */
+struct Sink
+{
+    static inline std::vector<pw::storage_event> events;
+
+    static void record(pw::storage_event const& event) noexcept { events.push_back(event); }
+};
+
+/**
+ * Not trivially relocatable so growing has to move or copy.  Element
+ * copies since its move may throw; NothrowElement moves.
+ */
+template<bool Nothrow>
+struct BasicElement
+{
+    BasicElement(int v)
+        : value(v)
+    {
+    }
+    BasicElement(BasicElement const& other)
+        : value(other.value)
+    {
+    }
+    BasicElement(BasicElement&& other) noexcept(Nothrow)
+        : value(other.value)
+    {
+    }
+    ~BasicElement() {}
+
+    int value;
+};
+
+using Element        = BasicElement<false>;
+using NothrowElement = BasicElement<true>;
+
+std::vector<pw::storage_event>
+drain()
+{
+    std::vector<pw::storage_event> events;
+    Ring::drain([&events](pw::storage_event const& event) { events.push_back(event); });
+    return events;
+}
+} // namespace
+
+TEST_CASE("storage_event_ring", "[vector][storage_observer]")
+{
+    drain();
+
+    SECTION("keeps the last Size events")
+    {
+        for (size_t count = 0; count < 10; ++count)
+        {
+            Ring::record(pw::storage_event { Kind::copy, 4, count, 0, 0 });
+        }
+        REQUIRE(Ring::size() == 8);
+        REQUIRE(Ring::dropped() == 2);
+
+        auto const events = drain();
+        REQUIRE(events.size() == 8);
+        REQUIRE(events.front().count == 2);
+        REQUIRE(events.back().count == 9);
+        REQUIRE(events.back().bytes() == 36);
+        REQUIRE(Ring::size() == 0);
+        REQUIRE(Ring::dropped() == 0);
+    }
+    SECTION("push_back() reports each reallocation and relocation")
+    {
+        pw::vector<int, ObservedAllocator<int, Ring>> v;
+        v.push_back(1);
+        v.push_back(2);
+        v.push_back(3);
+
+        auto const events = drain();
+        REQUIRE(events.size() == 5);
+        REQUIRE(events[0].what == Kind::reallocate);
+        REQUIRE(events[0].old_capacity == 0);
+        REQUIRE(events[0].new_capacity == 1);
+        REQUIRE(events[1].what == Kind::relocate);
+        REQUIRE(events[1].count == 1);
+        REQUIRE(events[3].what == Kind::relocate);
+        REQUIRE(events[3].count == 2);
+        REQUIRE(events[3].bytes() == 2 * sizeof(int));
+        REQUIRE(events[4].what == Kind::reallocate);
+        REQUIRE(events[4].new_capacity == 4);
+    }
+    SECTION("reserve() up front avoids the reallocations")
+    {
+        pw::vector<int, ObservedAllocator<int, Ring>> v;
+        v.reserve(3);
+        drain();
+        v.push_back(1);
+        v.push_back(2);
+        v.push_back(3);
+        REQUIRE(Ring::size() == 0);
+    }
+    SECTION("try_expand() reports growing in place and moving")
+    {
+        pw::vector<int, ExpandingAllocator<int, Ring>> v;
+        v.push_back(1);
+        drain();
+        v.push_back(2);
+
+        auto events = drain();
+        REQUIRE(events.size() == 1);
+        REQUIRE(events[0].what == Kind::reallocate);
+        REQUIRE(events[0].old_capacity == 1);
+        REQUIRE(events[0].new_capacity == 2);
+
+        v.push_back(3);
+        v.push_back(4);
+        drain();
+        v.push_back(5);
+
+        events = drain();
+        REQUIRE(events.size() == 2);
+        REQUIRE(events[0].what == Kind::relocate);
+        REQUIRE(events[0].count == 4);
+        REQUIRE(events[1].what == Kind::reallocate);
+        REQUIRE(events[1].old_capacity == 4);
+        REQUIRE(events[1].new_capacity == 8);
+        REQUIRE(v[0] == 1);
+        REQUIRE(v[4] == 5);
+    }
+    SECTION("shrink_to_fit() is a shrink")
+    {
+        pw::vector<int, ObservedAllocator<int, Ring>> v;
+        v.reserve(10);
+        v.push_back(1);
+        drain();
+        v.shrink_to_fit();
+
+        auto const events = drain();
+        REQUIRE(events.back().what == Kind::shrink);
+        REQUIRE(events.back().old_capacity == 10);
+        REQUIRE(events.back().new_capacity == 1);
+    }
+}
+
+TEST_CASE("storage_observer with a user sink", "[vector][storage_observer]")
+{
+    Sink::events.clear();
+    pw::vector<Element, ObservedAllocator<Element, Sink>> v;
+
+    SECTION("copies are reported when moving may throw")
+    {
+        v.reserve(2);
+        Element const value(1);
+        v.push_back(value);
+        v.push_back(value);
+        Sink::events.clear();
+        v.push_back(value);
+
+        REQUIRE(Sink::events.size() == 2);
+        REQUIRE(Sink::events[0].what == Kind::copy);
+        REQUIRE(Sink::events[0].count == 2);
+        REQUIRE(Sink::events[0].element_size == sizeof(Element));
+        REQUIRE(Sink::events[1].what == Kind::reallocate);
+    }
+    SECTION("moves are reported when moving can't throw")
+    {
+        pw::vector<NothrowElement, ObservedAllocator<NothrowElement, Sink>> nothrow;
+        nothrow.emplace_back(1);
+        Sink::events.clear();
+        nothrow.push_back(NothrowElement(2));
+
+        REQUIRE(Sink::events.size() == 2);
+        REQUIRE(Sink::events[0].what == Kind::move);
+        REQUIRE(Sink::events[0].count == 1);
+        REQUIRE(Sink::events[1].what == Kind::reallocate);
+    }
+}
@@ -1,4 +1,8 @@
 #include <pw/impl/memory/uninitialized_copy.h>
+#include <pw/impl/memory/uninitialized_default_construct.h>
+#include <pw/impl/memory/uninitialized_fill.h>
+#include <pw/impl/memory/uninitialized_move.h>
+#include <pw/impl/memory/uninitialized_value_construct.h>
 
 #include <tests/test/test_throwingtype.h>
 
@@ -34,3 +38,68 @@ SCENARIO("uninitialized_copy() handles exceptions", "[uninitialized_copy]")
         }
     }
 }
+
+SCENARIO("uninitialized_* algorithms on trivially copyable types", "[uninitialized_copy]")
+{
+    GIVEN("A source array of int and a destination that isn't zero")
+    {
+        int src[5] = { 1, 2, 3, 4, 5 };
+        int dst[5] = { -7, -7, -7, -7, -7 };
+
+        WHEN("uninitialized_copy() and uninitialized_move() are called")
+        {
+            pw::uninitialized_copy(&src[0], &src[3], &dst[0]);
+            int* end = pw::uninitialized_move(&src[3], &src[5], &dst[3]);
+            THEN("every element is copied")
+            {
+                REQUIRE(end == &dst[5]);
+                REQUIRE(dst[0] == 1);
+                REQUIRE(dst[2] == 3);
+                REQUIRE(dst[4] == 5);
+            }
+        }
+        WHEN("uninitialized_fill() is called with a value whose bytes differ")
+        {
+            pw::uninitialized_fill(&dst[0], &dst[4], 0x01020304);
+            THEN("the range is filled")
+            {
+                REQUIRE(dst[0] == 0x01020304);
+                REQUIRE(dst[3] == 0x01020304);
+                REQUIRE(dst[4] == -7);
+            }
+        }
+        WHEN("uninitialized_value_construct() is called")
+        {
+            pw::uninitialized_value_construct(&dst[1], &dst[4]);
+            THEN("the range is zero")
+            {
+                REQUIRE(dst[0] == -7);
+                REQUIRE(dst[1] == 0);
+                REQUIRE(dst[3] == 0);
+                REQUIRE(dst[4] == -7);
+            }
+        }
+    }
+}
+
+SCENARIO("uninitialized_default_construct() runs non-trivial default constructors", "[uninitialized_copy]")
+{
+    struct Defaulted
+    {
+        int value = 3;
+    };
+    GIVEN("Uninitialized memory for Defaulted")
+    {
+        alignas(Defaulted) unsigned char buf[sizeof(Defaulted) * 4] = {};
+        auto*                            dest = reinterpret_cast<Defaulted*>(buf);
+        WHEN("uninitialized_default_construct() is called")
+        {
+            pw::uninitialized_default_construct(dest, dest + 4);
+            THEN("each object is constructed")
+            {
+                REQUIRE(dest[0].value == 3);
+                REQUIRE(dest[3].value == 3);
+            }
+        }
+    }
+}
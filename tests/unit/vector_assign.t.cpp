@@ -71,6 +71,26 @@ TEMPLATE_LIST_TEST_CASE("Test assign()", "[vector][assign]", pw::test::TestTypeL
                 REQUIRE(pw::equal(&values[0], &values[count], v.begin(), v.end()));
             }
         }
+        WHEN("assign(begin,end) over more elements")
+        {
+            value_type       value;
+            constexpr size_t count         = 3;
+            value_type       values[count] = { pw::test::permute_n(value, 4, 1),
+                                               pw::test::permute_n(value, 4, 1),
+                                               pw::test::permute_n(value, 4, 1) };
+
+            v.resize(count + 5);
+            auto const* data = v.data();
+            v.assign(&values[0], &values[count]);
+            THEN("the memory is reused")
+            {
+                REQUIRE(v.data() == data);
+            }
+            THEN("all elements are same")
+            {
+                REQUIRE(pw::equal(&values[0], &values[count], v.begin(), v.end()));
+            }
+        }
         WHEN("assign(begin,end) with input iterators")
         {
             value_type                                 value;
@@ -280,3 +300,82 @@ TEMPLATE_LIST_TEST_CASE("Test assign() with int", "[vector][assign][int]", pw::t
         }
     }
 }
+
+TEMPLATE_LIST_TEST_CASE("assign() reuses capacity", "[vector][assign][int]", pw::test::TestTypeListInt)
+{
+    using Vector = TestType;
+
+    Vector v = { 1, 2, 3, 4, 5 };
+    v.reserve(10);
+    auto const* data = v.data();
+
+    SECTION("assign(begin, end) with fewer elements")
+    {
+        int arr[] = { 7, 8 };
+        v.assign(arr, arr + 2);
+        REQUIRE(v == Vector { 7, 8 });
+        REQUIRE(v.data() == data);
+    }
+    SECTION("assign(begin, end) with more elements")
+    {
+        int arr[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+        v.assign(arr, arr + 8);
+        REQUIRE(v == Vector { 1, 2, 3, 4, 5, 6, 7, 8 });
+        REQUIRE(v.data() == data);
+    }
+    SECTION("assign(begin, end) with input iterators")
+    {
+        int                                 arr[] = { 9, 8, 7 };
+        pw::test::test_input_iterator<int*> first { arr };
+        pw::test::test_input_iterator<int*> last { arr + 3 };
+        v.assign(first, last);
+        REQUIRE(v == Vector { 9, 8, 7 });
+        REQUIRE(v.data() == data);
+
+        int more[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+        v.assign(pw::test::test_input_iterator<int*> { more }, pw::test::test_input_iterator<int*> { more + 12 });
+        REQUIRE(v.size() == 12);
+        REQUIRE(v[11] == 12);
+    }
+    SECTION("assign(count, value)")
+    {
+        v.assign(8, 42);
+        REQUIRE(v.size() == 8);
+        REQUIRE(v.data() == data);
+        REQUIRE(v[7] == 42);
+        v.assign(2, 3);
+        REQUIRE(v == Vector { 3, 3 });
+        REQUIRE(v.data() == data);
+    }
+    SECTION("assign(count, value) with an element of the vector")
+    {
+        v.assign(8, v[4]);
+        REQUIRE(v == Vector { 5, 5, 5, 5, 5, 5, 5, 5 });
+        v.assign(20, v[0]);
+        REQUIRE(v.size() == 20);
+        REQUIRE(v[19] == 5);
+    }
+    SECTION("assign(init_list) and operator=(init_list)")
+    {
+        v.assign({ 6, 7, 8, 9, 10, 11 });
+        REQUIRE(v == Vector { 6, 7, 8, 9, 10, 11 });
+        REQUIRE(v.data() == data);
+        v = { 1 };
+        REQUIRE(v == Vector { 1 });
+        REQUIRE(v.data() == data);
+    }
+    SECTION("operator=(vector const&)")
+    {
+        Vector const other = { 10, 20, 30, 40, 50, 60, 70 };
+        v                  = other;
+        REQUIRE(v == other);
+        REQUIRE(v.data() == data);
+    }
+    SECTION("only allocates when capacity() is too small")
+    {
+        Vector const other(static_cast<typename Vector::size_type>(11), 1);
+        v = other;
+        REQUIRE(v == other);
+        REQUIRE(v.capacity() >= 11);
+    }
+}
@@ -182,9 +182,15 @@ TEST_CASE("Move Assignment use allocator", "[assignment][allocator][move]")
 
         WHEN("Use move() assignmet")
         {
-            v1 = pw::move(v2);
+            auto const* data = v2.data();
+            v1               = pw::move(v2);
             REQUIRE(v1.get_allocator() == alloc2);
-            REQUIRE(v1[0] == v2[0]);
+            REQUIRE(v1[0] == 4);
+            THEN("the memory is taken over")
+            {
+                REQUIRE(v1.data() == data);
+                REQUIRE(v2.empty());
+            }
         }
     }
     GIVEN("A vector with propagate_on_move_assignment = false")
@@ -262,13 +268,39 @@ SCENARIO("Assignment operator", "[vector][operator=]")
         }
         WHEN("operator=(move) lhs.size() < rhs.size() but lhs capacity")
         {
-            Vector lhs { 1, 2 };
-            Vector rhs { 1, 2, 3 };
+            Vector       lhs { 1, 2 };
+            Vector       rhs { 1, 2, 3 };
+            Vector const expected = rhs;
             lhs.reserve(rhs.size());
             lhs = pw::move(rhs);
-            THEN("they are same")
+            THEN("lhs has the values")
             {
-                REQUIRE(lhs == rhs);
+                REQUIRE(lhs == expected);
+            }
+        }
+        WHEN("operator=(move) with equal allocators")
+        {
+            Vector      lhs { 1, 2 };
+            Vector      rhs { 1, 2, 3 };
+            auto const* data = rhs.data();
+            lhs              = pw::move(rhs);
+            THEN("lhs takes over the memory")
+            {
+                REQUIRE(lhs.data() == data);
+                REQUIRE(lhs.size() == 3);
+                REQUIRE(rhs.empty());
+            }
+        }
+        WHEN("operator=(move) with unequal allocators and not enough capacity")
+        {
+            Vector lhs({ 1 }, Vector::allocator_type(1));
+            Vector rhs({ 1, 2, 3, 4, 5, 6, 7, 8, 9 }, Vector::allocator_type(2));
+            lhs.shrink_to_fit();
+            lhs = pw::move(rhs);
+            THEN("lhs allocates and moves the elements")
+            {
+                REQUIRE(lhs.get_allocator() == Vector::allocator_type(1));
+                REQUIRE(lhs == Vector { 1, 2, 3, 4, 5, 6, 7, 8, 9 });
             }
         }
     }
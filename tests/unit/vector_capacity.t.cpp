@@ -86,9 +86,9 @@ TEMPLATE_LIST_TEST_CASE("capacity methods", "[vector][capacity]", pw::test::Test
         WHEN("capacity() is called")
         {
             size_t c = v.capacity();
-            THEN("capacity is same")
+            THEN("capacity is at least size()")
             {
-                REQUIRE(generate.count == c);
+                REQUIRE(c >= generate.count);
             }
         }
         WHEN("empty() is called")
@@ -130,7 +130,7 @@ TEMPLATE_LIST_TEST_CASE("capacity methods", "[vector][capacity]", pw::test::Test
         {
             size_t const total = generate.count + 10;
             v.reserve(total);
-            REQUIRE(total == v.capacity());
+            REQUIRE(v.capacity() >= total);
         }
     }
 }
@@ -33,6 +33,7 @@ TEMPLATE_LIST_TEST_CASE("clear methods", "[vector][clear]", pw::test::TestTypeLi
 
         WHEN("clear() is called")
         {
+            auto const capacity = v.capacity();
             v.clear();
             THEN("it is empty")
             {
@@ -40,7 +41,7 @@ TEMPLATE_LIST_TEST_CASE("clear methods", "[vector][clear]", pw::test::TestTypeLi
             }
             THEN("capacity() is same")
             {
-                REQUIRE(generate.count == v.capacity());
+                REQUIRE(capacity == v.capacity());
             }
         }
         WHEN("clear() is called then shrink_to_fit()")
@@ -45,4 +45,13 @@ TEMPLATE_LIST_TEST_CASE("comparison", "[vector][compare]", pw::test::TestTypeLis
         REQUIRE(v2 > v1);
         REQUIRE(v2 >= v1);
     }
-}
\ No newline at end of file
+    GIVEN("Two vectors that differ by sign")
+    {
+        Vector v1 { 1, -2 };
+        Vector v2 { 1, 2 };
+
+        REQUIRE(v1 != v2);
+        REQUIRE(v1 < v2);
+        REQUIRE(v2 > v1);
+    }
+}
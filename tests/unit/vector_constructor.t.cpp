@@ -4,6 +4,9 @@
 #include <test_input_iterator.h>
 #include <test_testtype.h>
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <tuple>
 #include <vector>
 
@@ -1086,3 +1089,105 @@ TEMPLATE_LIST_TEST_CASE("Constructor allocator passing - AllocatorOnlyType",
         }
     }
 }
+
+TEST_CASE("Move constructors take over the memory", "[vector][constructor][move]")
+{
+    using Vector = pw::vector<int, pw::test::allocator_base<int>>;
+
+    Vector      source({ 1, 2, 3 }, Vector::allocator_type(1));
+    auto const* data = source.data();
+
+    SECTION("vector(vector&&)")
+    {
+        Vector moved(pw::move(source));
+        REQUIRE(moved.data() == data);
+        REQUIRE(moved.size() == 3);
+        REQUIRE(source.empty());
+        REQUIRE(source.capacity() == 0);
+    }
+    SECTION("vector(vector&&, alloc) with an equal allocator")
+    {
+        Vector moved(pw::move(source), Vector::allocator_type(1));
+        REQUIRE(moved.data() == data);
+        REQUIRE(source.empty());
+    }
+    SECTION("vector(vector&&, alloc) with a different allocator")
+    {
+        Vector moved(pw::move(source), Vector::allocator_type(2));
+        REQUIRE(moved.data() != data);
+        REQUIRE(moved == Vector { 1, 2, 3 });
+        REQUIRE(moved.get_allocator() == Vector::allocator_type(2));
+    }
+}
+
+namespace {
+/**
+ * Counts calls to allocate_zeroed().  allocate() hands back memory
+ * that isn't zero so a missing value initialization shows up.
+ */
+template<class Type>
+struct ZeroingAllocator
+{
+    using value_type = Type;
+
+    static inline int s_zeroed = 0;
+
+    ZeroingAllocator() = default;
+    template<class Other>
+    ZeroingAllocator(ZeroingAllocator<Other> const&)
+    {
+    }
+
+    Type* allocate(size_t count)
+    {
+        void* p = std::malloc(count * sizeof(Type));
+        std::memset(p, 0xff, count * sizeof(Type));
+        return static_cast<Type*>(p);
+    }
+    pw::allocation_result<Type*, size_t> allocate_zeroed(size_t count)
+    {
+        ++s_zeroed;
+        return { static_cast<Type*>(std::calloc(count, sizeof(Type))), count };
+    }
+    void deallocate(Type* ptr, size_t) { std::free(ptr); }
+
+    friend bool operator==(ZeroingAllocator const&, ZeroingAllocator const&) { return true; }
+};
+} // namespace
+
+TEST_CASE("vector(count) takes zeroed memory from allocate_zeroed()",
+          "[vector][constructor][allocate_zeroed]")
+{
+    ZeroingAllocator<double>::s_zeroed = 0;
+    ZeroingAllocator<int*>::s_zeroed   = 0;
+
+    SECTION("Arithmetic and pointer elements don't construct anything")
+    {
+        pw::vector<double, ZeroingAllocator<double>> doubles(1000);
+        pw::vector<int*, ZeroingAllocator<int*>>     pointers(10);
+        REQUIRE(ZeroingAllocator<double>::s_zeroed == 1);
+        REQUIRE(ZeroingAllocator<int*>::s_zeroed == 1);
+        REQUIRE(doubles.size() == 1000);
+        REQUIRE(std::count(doubles.begin(), doubles.end(), 0.0) == 1000);
+        REQUIRE(pointers[9] == nullptr);
+    }
+    SECTION("Other elements and empty vectors are value initialized as before")
+    {
+        struct Pair
+        {
+            int first;
+            int second;
+        };
+        pw::vector<Pair, ZeroingAllocator<Pair>>     pairs(5);
+        pw::vector<double, ZeroingAllocator<double>> empty(0);
+        REQUIRE(ZeroingAllocator<Pair>::s_zeroed == 0);
+        REQUIRE(ZeroingAllocator<double>::s_zeroed == 0);
+        REQUIRE(pairs[4].second == 0);
+        REQUIRE(empty.empty());
+    }
+    SECTION("pw::allocator provides it")
+    {
+        pw::vector<long> longs(100000);
+        REQUIRE(std::count(longs.begin(), longs.end(), 0L) == 100000);
+    }
+}
@@ -34,6 +34,7 @@ TEMPLATE_LIST_TEST_CASE("emplace_back()", "[vector][func][emplace_back]", pw::te
 
         WHEN("emplace_back() without enough capacity")
         {
+            v.shrink_to_fit();
             REQUIRE(v.capacity() == v.size());
             v.emplace_back(gen.last_value);
             THEN("capacity increased")
@@ -3,6 +3,9 @@
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <string>
+#include <type_traits>
+
 /*
  * Type Requirments
  * - erase(): MoveAssignable
@@ -104,3 +107,39 @@ TEMPLATE_LIST_TEST_CASE("Test erase", "[vector][erase]", pw::test::TestTypeListI
         }
     }
 }
+
+TEMPLATE_TEST_CASE("erase() keeps the elements after the range", "[vector][erase]", int, std::string)
+{
+    using Vector = pw::vector<TestType>;
+
+    auto make = [](int i) {
+        if constexpr (std::is_same_v<TestType, int>)
+            return i;
+        else
+            return std::string(20, static_cast<char>('a' + i));
+    };
+    Vector v;
+    for (int i = 0; i < 6; ++i)
+    {
+        v.push_back(make(i));
+    }
+
+    SECTION("erase() from the front")
+    {
+        auto iter = v.erase(v.begin(), v.begin() + 2);
+        REQUIRE(iter == v.begin());
+        REQUIRE(v == Vector { make(2), make(3), make(4), make(5) });
+    }
+    SECTION("erase() from the middle")
+    {
+        auto iter = v.erase(v.begin() + 2, v.begin() + 5);
+        REQUIRE(*iter == make(5));
+        REQUIRE(v == Vector { make(0), make(1), make(5) });
+    }
+    SECTION("erase() to the end")
+    {
+        auto iter = v.erase(v.begin() + 3, v.end());
+        REQUIRE(iter == v.end());
+        REQUIRE(v == Vector { make(0), make(1), make(2) });
+    }
+}
@@ -10,6 +10,11 @@
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 /*
  * Type requirements:
  * - insert(const_iterator pos, const T& value): CopyAssignable and CopyInsertable
@@ -150,6 +155,7 @@ TEMPLATE_LIST_TEST_CASE("Test insert(pos, value&&)", "[vector][insert][move]", p
     {
         pw::test::Values<Vector> generate(5);
         Vector                   v(generate.values);
+        v.shrink_to_fit();
         REQUIRE(v.size() == v.capacity());
         WHEN("insert(begin(), pw::move(value)) is called with not enough capacity")
         {
@@ -267,7 +273,7 @@ TEMPLATE_LIST_TEST_CASE("Test insert(pos, value&&)", "[vector][insert][move]", p
 
             THEN("back() is value")
             {
-                REQUIRE(v.back() == value);
+                REQUIRE(v.back() == moved_value);
             }
             THEN("front() is first value")
             {
@@ -596,6 +602,7 @@ SCENARIO("insert(pos, init_list)", "[vector][insert][init_list]")
         Vector           v { 1, 2, 3, 4, 5 };
         Vector const     expected = { -1, -2, 1, 2, 3, 4, 5 };
         Vector::iterator iter;
+        v.shrink_to_fit();
         REQUIRE(v.size() == v.capacity());
         WHEN("insert(begin, init_list) without capacity")
         {
@@ -711,3 +718,92 @@ SCENARIO("insert() op counts", "[vector][insert][optracker]")
     INFO("init: " << init << " counter: " << counter);
     REQUIRE(counter.constructorCount() == counter.destructorCount());
 }
+
+TEMPLATE_TEST_CASE("insert() shifts the tail in place", "[vector][insert]", int, std::string)
+{
+    using Vector    = pw::vector<TestType>;
+    using size_type = Vector::size_type;
+
+    auto make = [](int i) {
+        if constexpr (std::is_same_v<TestType, int>)
+            return i;
+        else
+            return std::to_string(i);
+    };
+    Vector v;
+    v.reserve(20);
+    for (int i = 0; i < 5; ++i)
+    {
+        v.push_back(make(i));
+    }
+    auto const* data = v.data();
+
+    SECTION("insert(pos, count, value) with count less than the tail")
+    {
+        v.insert(v.begin() + 1, size_type { 2 }, make(9));
+        REQUIRE(v == Vector { make(0), make(9), make(9), make(1), make(2), make(3), make(4) });
+    }
+    SECTION("insert(pos, count, value) with count more than the tail")
+    {
+        v.insert(v.begin() + 4, 3, make(9));
+        REQUIRE(v == Vector { make(0), make(1), make(2), make(3), make(9), make(9), make(9), make(4) });
+    }
+    SECTION("insert(pos, count, value) where value is an element that moves")
+    {
+        v.insert(v.begin(), size_type { 3 }, v[2]);
+        REQUIRE(v == Vector { make(2), make(2), make(2), make(0), make(1), make(2), make(3), make(4) });
+    }
+    SECTION("insert(pos, value) where value is an element that moves")
+    {
+        v.insert(v.begin() + 1, v.back());
+        REQUIRE(v == Vector { make(0), make(4), make(1), make(2), make(3), make(4) });
+    }
+    SECTION("insert(pos, init_list) with more elements than the tail")
+    {
+        v.insert(v.begin() + 3, { make(7), make(8), make(9) });
+        REQUIRE(v == Vector { make(0), make(1), make(2), make(7), make(8), make(9), make(3), make(4) });
+    }
+    SECTION("insert(pos, init_list) with fewer elements than the tail")
+    {
+        v.insert(v.begin(), { make(7), make(8) });
+        REQUIRE(v == Vector { make(7), make(8), make(0), make(1), make(2), make(3), make(4) });
+    }
+    SECTION("insert(pos, first, last) with forward iterators")
+    {
+        std::list<TestType> const source { make(7), make(8), make(9) };
+        auto                      iter = v.insert(v.begin() + 1, source.begin(), source.end());
+        REQUIRE(iter == v.begin() + 1);
+        REQUIRE(v == Vector { make(0), make(7), make(8), make(9), make(1), make(2), make(3), make(4) });
+    }
+    SECTION("insert(pos, first, last) with input iterators")
+    {
+        std::vector<TestType>                                          source { make(7), make(8), make(9) };
+        pw::test::test_input_iterator<typename std::vector<TestType>::iterator> first { source.begin() };
+        pw::test::test_input_iterator<typename std::vector<TestType>::iterator> last { source.end() };
+        auto iter = v.insert(v.begin() + 2, first, last);
+        REQUIRE(iter == v.begin() + 2);
+        REQUIRE(v == Vector { make(0), make(1), make(7), make(8), make(9), make(2), make(3), make(4) });
+    }
+    SECTION("emplace(pos, args) where args is an element that moves")
+    {
+        v.emplace(v.begin(), v[4]);
+        REQUIRE(v == Vector { make(4), make(0), make(1), make(2), make(3), make(4) });
+    }
+    REQUIRE(v.data() == data);
+}
+
+TEST_CASE("insert(pos, first, last) reallocates once", "[vector][insert]")
+{
+    pw::vector<int>       v { 1, 2, 3, 4 };
+    std::list<int> const  source(1000, 7);
+    v.shrink_to_fit();
+
+    auto iter = v.insert(v.begin() + 2, source.begin(), source.end());
+    REQUIRE(iter == v.begin() + 2);
+    REQUIRE(v.size() == 1004);
+    REQUIRE(v[1] == 2);
+    REQUIRE(v[2] == 7);
+    REQUIRE(v[1001] == 7);
+    REQUIRE(v[1002] == 3);
+    REQUIRE(v.back() == 4);
+}
@@ -1,6 +1,7 @@
 #include <test_testtype.h>
 
 #include <pw/impl/memory_resource/pmr_polymorphic_allocator.h>
+#include <pw/impl/utility/move.h>
 #include <test_optracker_copyconstructible.h>
 #include <test_optracker_defaultcopyconstructible.h>
 #include <test_optracker_moveconstructible.h>
@@ -30,7 +31,7 @@ TEMPLATE_LIST_TEST_CASE("push_back()", "[vector][push_back]", pw::test::TestType
             v.push_back(value);
             THEN("capacity() is increased")
             {
-                REQUIRE(v.capacity() == 1);
+                REQUIRE(v.capacity() >= 1);
             }
             THEN("value is there")
             {
@@ -141,10 +142,11 @@ SCENARIO("push_back() op counts", "[vector][push_back][optracker]")
         {
             generate.values.push_back(copyObject);
             counter = copyObject.opCounter() - counter;
-            THEN("Copy constructed existing items and new item")
+            THEN("Existing items are moved and only the new item is copied")
             {
                 INFO("counter: " << counter);
-                REQUIRE(generate.count + 1 == counter.getCopyConstructor());
+                REQUIRE(1 == counter.getCopyConstructor());
+                REQUIRE(generate.count == static_cast<pw::size_t>(counter.getMoveConstructor()));
             }
         }
     }
@@ -153,6 +155,62 @@ SCENARIO("push_back() op counts", "[vector][push_back][optracker]")
     REQUIRE(counter.constructorCount() == counter.destructorCount());
 }
 
+namespace {
+/**
+ * Copyable but moving may throw so growing has to copy to keep the
+ * strong exception guarantee
+ */
+struct ThrowingMove : pw::test::OpTrackerCopyConstructible
+{
+    using OpTrackerCopyConstructible::OpTrackerCopyConstructible;
+    ThrowingMove(ThrowingMove const& copy) = default;
+    ThrowingMove(ThrowingMove&& move) noexcept(false)
+        : OpTrackerCopyConstructible(pw::move(move))
+    {
+    }
+};
+} // namespace
+
+SCENARIO("push_back() copies elements whose move may throw", "[vector][push_back][optracker]")
+{
+    using Vector = pw::vector<ThrowingMove>;
+
+    GIVEN("A full vector of 5 elements")
+    {
+        Vector v;
+        for (int value = 0; value < 5; ++value)
+        {
+            v.push_back(ThrowingMove(value));
+        }
+        v.shrink_to_fit();
+        ThrowingMove const  copyObject(12);
+        pw::test::OpCounter counter = pw::test::OpTrackerCopyConstructible::getCounter();
+
+        WHEN("push_back() is called")
+        {
+            v.push_back(copyObject);
+            counter = pw::test::OpTrackerCopyConstructible::getCounter() - counter;
+            THEN("Existing items and the new item are copied")
+            {
+                INFO("counter: " << counter);
+                REQUIRE(6 == counter.getCopyConstructor());
+                REQUIRE(0 == counter.getMoveConstructor());
+            }
+        }
+        WHEN("reserve() is called")
+        {
+            v.reserve(20);
+            counter = pw::test::OpTrackerCopyConstructible::getCounter() - counter;
+            THEN("Existing items are copied")
+            {
+                INFO("counter: " << counter);
+                REQUIRE(5 == counter.getCopyConstructor());
+                REQUIRE(0 == counter.getMoveConstructor());
+            }
+        }
+    }
+}
+
 TEST_CASE("push_back() method", "[vector][push_back][modifiers]")
 {
     using Vector = pw::vector<int>;
@@ -359,7 +417,7 @@ TEST_CASE("push_back() method", "[vector][push_back][modifiers]")
             v.reserve(pre_allocate);
             auto reserved_capacity = v.capacity();
 
-            REQUIRE(reserved_capacity == pre_allocate);
+            REQUIRE(reserved_capacity >= pre_allocate);
             for (int i = 0; i < pre_allocate; ++i)
             {
                 v.push_back(i);
@@ -368,7 +426,7 @@ TEST_CASE("push_back() method", "[vector][push_back][modifiers]")
             THEN("capacity remains unchanged")
             {
                 REQUIRE(v.size() == pre_allocate);
-                REQUIRE(v.capacity() == pre_allocate); // Should not reallocate
+                REQUIRE(v.capacity() == reserved_capacity); // Should not reallocate
             }
             THEN("all elements are stored correctly")
             {
@@ -431,6 +489,22 @@ TEST_CASE("push_back() method", "[vector][push_back][modifiers]")
                 REQUIRE(v.back() == (count - 1) * 2);
             }
         }
+        WHEN("push_back() of its own element when full")
+        {
+            Vector v = { 1, 2, 3, 4 };
+            v.shrink_to_fit();
+            REQUIRE(v.size() == v.capacity());
+
+            v.push_back(v[1]);
+            v.push_back(v.back());
+
+            THEN("the copied values are appended")
+            {
+                REQUIRE(v.size() == 6);
+                REQUIRE(v[4] == 2);
+                REQUIRE(v[5] == 2);
+            }
+        }
         WHEN("push_back() after clear")
         {
             Vector v = { 1, 2, 3, 4, 5 };
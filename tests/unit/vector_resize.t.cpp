@@ -7,6 +7,9 @@
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <stdexcept>
+#include <string>
+
 /*
  * Type requirements
  * - resize(size_type count): MoveInsertable and DefaultInsertable
@@ -347,12 +350,14 @@ SCENARIO("resize() op counts", "[vector][resize][optracker]")
             counter = pw::test::OpTrackerDefaultCopyConstructible::getCounter();
             v.resize(v.size() + 2);
             counter = pw::test::OpTrackerDefaultCopyConstructible::getCounter() - counter;
-            THEN("new elements are default constructed and original copy constructed")
+            THEN("new elements are default constructed and original moved")
             {
-                // Expect copy construction so exceptions leave unchanged
+                // The move constructor is noexcept so moving keeps the strong guarantee
                 INFO("counter: " << counter);
                 REQUIRE(2 == counter.getDefaultConstructor());
-                REQUIRE(counter.getDefaultConstructor() + counter.getCopyConstructor() ==
+                REQUIRE(3 == counter.getMoveConstructor());
+                REQUIRE(0 == counter.getCopyConstructor());
+                REQUIRE(counter.getDefaultConstructor() + counter.getMoveConstructor() ==
                         counter.constructorCount());
             }
         }
@@ -1288,3 +1293,87 @@ TEST_CASE("resize() with value method", "[vector][resize][modifiers][value]")
         }
     }
 }
+
+TEST_CASE("resize_for_overwrite()", "[vector][resize][resize_for_overwrite]")
+{
+    SECTION("trivial elements are not written")
+    {
+        pw::vector<int> v { 7, 7, 7, 7, 7 };
+        auto const*     data = v.data();
+
+        v.resize(1);
+        v.resize_for_overwrite(5);
+        REQUIRE(v.size() == 5);
+        REQUIRE(v.data() == data);
+        // The old values are still in memory since nothing was constructed
+        REQUIRE(v[4] == 7);
+    }
+    SECTION("grows the capacity")
+    {
+        pw::vector<int> v { 1, 2, 3 };
+        v.resize_for_overwrite(1000);
+        REQUIRE(v.size() == 1000);
+        REQUIRE(v.capacity() >= 1000);
+        REQUIRE(v[0] == 1);
+        REQUIRE(v[2] == 3);
+    }
+    SECTION("growing in steps uses the growth policy")
+    {
+        pw::vector<int> v;
+        int             reallocations = 0;
+        for (int step = 0; step < 5; ++step)
+        {
+            auto const capacity = v.capacity();
+            v.resize_for_overwrite(v.size() + 1000);
+            reallocations += v.capacity() != capacity;
+        }
+        REQUIRE(v.size() == 5000);
+        REQUIRE(reallocations < 5);
+    }
+    SECTION("shrinks like resize()")
+    {
+        pw::vector<int> v { 1, 2, 3 };
+        v.resize_for_overwrite(1);
+        REQUIRE(v == pw::vector<int> { 1 });
+    }
+    SECTION("non-trivial elements are default constructed")
+    {
+        pw::vector<std::string> v { "one" };
+        v.resize_for_overwrite(3);
+        REQUIRE(v.size() == 3);
+        REQUIRE(v[0] == "one");
+        REQUIRE(v[2].empty());
+    }
+}
+
+TEST_CASE("resize_and_overwrite()", "[vector][resize][resize_and_overwrite]")
+{
+    SECTION("op writes the elements and returns the new size")
+    {
+        pw::vector<char> v { 'a', 'b' };
+        v.resize_and_overwrite(10, [](char* p, std::size_t count) {
+            REQUIRE(count == 10);
+            REQUIRE(p[0] == 'a');
+            p[2] = 'c';
+            p[3] = 'd';
+            return 4;
+        });
+        REQUIRE(v == pw::vector<char> { 'a', 'b', 'c', 'd' });
+        REQUIRE(v.capacity() >= 10);
+    }
+    SECTION("op can shrink below the old size")
+    {
+        pw::vector<std::string> v { "one", "two", "three" };
+        v.resize_and_overwrite(5, [](std::string* p, std::size_t) {
+            p[0] = "zero";
+            return 1;
+        });
+        REQUIRE(v == pw::vector<std::string> { "zero" });
+    }
+    SECTION("a result larger than count throws")
+    {
+        pw::vector<int> v;
+        REQUIRE_THROWS_AS(v.resize_and_overwrite(3, [](int*, std::size_t) { return 4; }), std::length_error);
+        REQUIRE_THROWS_AS(v.resize_and_overwrite(3, [](int*, std::size_t) { return -1; }), std::length_error);
+    }
+}